@@ -0,0 +1,332 @@
+#include "batchrunner.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QTimer>
+
+#include "error_code.h"
+#include "ortsessioncache.h"
+#include "spectengine.h"
+#include "threadbudget.h"
+
+namespace {
+
+int WriteTensorAsFloat32(const Tensor& tensor, const QString& path)
+{
+    std::ofstream outstream(path.toStdString(),
+                            std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!outstream.is_open()) {
+        return EINVALID_PATH;
+    }
+    const std::vector<double>& data = tensor.data();
+    std::vector<float> buffer(data.cbegin(), data.cend());
+    outstream.write(reinterpret_cast<const char *>(buffer.data()),
+                    static_cast<std::streamsize>(buffer.size() * sizeof(float)));
+    return outstream ? 0 : EUNKNOWN;
+}
+
+QString GetShapeString(const Tensor& tensor)
+{
+    QStringList dims;
+    for (int dim: tensor.shape()) dims << QString::number(dim);
+    return dims.join("x");
+}
+
+} // namespace
+
+BatchRunner::BatchRunner(const QStringList &task_paths, QObject *parent):
+    QObject(parent)
+{
+    jobs_.resize(task_paths.size());
+    for (int i = 0; i < task_paths.size(); ++i) {
+        jobs_[i].path = task_paths[i];
+    }
+    connect(this, &BatchRunner::JobPrepared, this, &BatchRunner::Dispatch_, Qt::QueuedConnection);
+}
+
+BatchRunner::~BatchRunner()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (prepare_thread_.joinable()) prepare_thread_.join();
+}
+
+void BatchRunner::SetNumWorkers(int num_workers)
+{
+    num_workers_ = std::max(1, num_workers);
+}
+
+void BatchRunner::SetPipelineDepth(int pipeline_depth)
+{
+    pipeline_depth_ = static_cast<size_t>(std::max(1, pipeline_depth));
+}
+
+void BatchRunner::Start()
+{
+    timer_.start();
+    prepare_thread_ = std::thread([this]() { Prepare_(); });
+    Dispatch_();
+}
+
+void BatchRunner::Prepare_()
+{
+    for (size_t i = 0; i < jobs_.size(); ++i) {
+        {
+            // Wait for room in the queue of prepared jobs.
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() {
+                return stopping_ || num_prepared_ - next_job_ < pipeline_depth_;
+            });
+            if (stopping_) return;
+        }
+        QElapsedTimer timer;
+        timer.start();
+        PrepareJob_(jobs_[i]);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            preparation_busy_ms_ += timer.elapsed();
+            ++num_prepared_;
+        }
+        emit(JobPrepared());
+    }
+}
+
+void BatchRunner::PrepareJob_(Job &job)
+{
+    job.timer.start();
+    job.prepare_status = job.param.FromProtobufFilePath(job.path);
+    if (job.prepare_status != 0) return;
+    if (!output_dir_.isEmpty()) job.param.output_dir = output_dir_;
+    job.load_ms = job.timer.elapsed();
+    if (!job.param.use_nn || !QFileInfo::exists(job.param.GetModelPath())) return;
+
+    QElapsedTimer timer;
+    timer.start();
+    try {
+        job.restored = ReconThread::Restore(job.param, ReconThread::GetRestorationKey(job.param), [this]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return !stopping_;
+        });
+    } catch (const Ort::Exception& e) {
+        // Left to the worker, which reports the failure with the task.
+        std::cerr << "Restoration of " << job.path.toStdString() << " failed: " << e.what() << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Restoration of " << job.path.toStdString() << " failed: " << e.what() << std::endl;
+    }
+    job.restoration_ms = timer.elapsed();
+}
+
+void BatchRunner::Dispatch_()
+{
+    while (num_running_ < num_workers_ && next_job_ < jobs_.size()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (next_job_ == num_prepared_) break;
+            ++next_job_;
+        }
+        cv_.notify_all();
+        Job& job = jobs_[next_job_ - 1];
+        int rv = job.prepare_status != 0 ? job.prepare_status : StartJob_(job);
+        if (rv != 0) {
+            std::cerr << "[failed] " << job.path.toStdString()
+                      << ": could not start task (error " << rv << ")." << std::endl;
+            ++num_failed_;
+            job.param = ReconTaskParameter();
+            job.restored.reset();
+            continue;
+        }
+        ++num_running_;
+    }
+    if (num_running_ == 0 && next_job_ == jobs_.size()) {
+        const int num_jobs = static_cast<int>(jobs_.size());
+        std::cout << num_jobs - num_failed_ << " of " << num_jobs
+                  << " task(s) succeeded in " << timer_.elapsed() << " (ms)." << std::endl;
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::cout << "Stages busy: preparation " << preparation_busy_ms_
+                  << " ms, reconstruction " << reconstruction_busy_ms_ << " ms." << std::endl;
+        emit(Finished(num_failed_));
+    }
+}
+
+int BatchRunner::StartJob_(Job &job)
+{
+    job.thread = SpectEngine::Instance().CreateWorker(this);
+    const int thread_budget = reconstruction_threads_ > 0
+            ? reconstruction_threads_ : std::max(1, GetHardwareThreadCount() / num_workers_);
+    job.thread->SetThreadBudget(thread_budget);
+    job.thread->SetRestoredSinogram(job.restored);
+    job.restored.reset();
+    int rv = job.thread->SetParameter(job.param);
+    if (rv != 0) {
+        delete job.thread;
+        job.thread = nullptr;
+        return rv;
+    }
+    const size_t job_index = &job - jobs_.data();
+    connect(job.thread, &QThread::finished, this, [this, job_index]() {
+        OnJobFinished_(job_index);
+    });
+    job.thread->start();
+    return 0;
+}
+
+void BatchRunner::OnJobFinished_(size_t job_index)
+{
+    Job& job = jobs_[job_index];
+    --num_running_;
+    qint64 write_ms = 0;
+    int rv = EUNKNOWN;
+    if (job.thread->GetProgress() == 100) {
+        rv = WriteResults_(job, &write_ms);
+    }
+    const ReconThread::StageTimings& timings = job.thread->GetStageTimings();
+    reconstruction_busy_ms_ += timings.prepare_ms + timings.reconstruction_ms + timings.postprocess_ms;
+    if (rv == 0) {
+        std::cout << "[done] ";
+    } else {
+        ++num_failed_;
+        std::cout << "[failed] ";
+    }
+    std::cout << job.path.toStdString()
+              << ": load " << job.load_ms
+              << " ms, restoration " << job.restoration_ms
+              << " ms, prepare " << timings.prepare_ms
+              << " ms (restoration " << timings.restoration_ms
+              << " ms), reconstruction " << timings.reconstruction_ms
+              << " ms, postprocess " << timings.postprocess_ms
+              << " ms, write " << write_ms
+              << " ms, total " << job.timer.elapsed() << " ms." << std::endl;
+
+    job.thread->deleteLater();
+    job.thread = nullptr;
+    job.param = ReconTaskParameter();
+    Dispatch_();
+}
+
+int BatchRunner::WriteResults_(Job &job, qint64 *write_ms)
+{
+    QElapsedTimer timer;
+    timer.start();
+    const SharedTensorArray& result_array = job.thread->GetResultArray();
+    if (!result_array || result_array->empty()) return EUNKNOWN;
+
+    Tensor result = job.thread->GetResultVolume();
+    if (result.shape().size() != 3) result = result_array->front();
+    QDir output_dir(job.thread->GetOutputDir());
+    const QString basename = job.param.task_name.isEmpty()
+            ? QFileInfo(job.path).completeBaseName() : job.param.task_name;
+    const QString result_path = output_dir.filePath(
+                basename + "_" + GetShapeString(result) + ".f32");
+    int rv = WriteTensorAsFloat32(result, result_path);
+    if (rv != 0) return rv;
+
+    auto task_result = std::make_shared<ReconTaskResult>();
+    task_result->reconstructed_tomographs = result_array;
+    task_result->sinogram_used_to_reconstruct = job.thread->GetSinogramUsedToReconstruct();
+    job.param.result = task_result;
+    rv = job.param.ToProtobufFilePath(output_dir.filePath(basename + ".task"));
+    *write_ms = timer.elapsed();
+    return rv;
+}
+
+int RunBatch(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Reconstructs .task files without a GUI.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("batch", "Run in batch mode."));
+    QCommandLineOption workers_option("workers",
+                                      "Number of tasks reconstructed at a time.", "n", "1");
+    parser.addOption(workers_option);
+    QCommandLineOption output_option("output",
+                                     "Output directory overriding the one of each task.", "dir");
+    parser.addOption(output_option);
+    QCommandLineOption restoration_threads_option(
+                "restoration-threads", "Threads of the restoration stage, 0 for the session "
+                "options or a quarter of the hardware threads.", "n", "0");
+    parser.addOption(restoration_threads_option);
+    QCommandLineOption reconstruction_threads_option(
+                "reconstruction-threads", "Threads of each reconstructing worker, 0 to share "
+                "the threads left by restoration.", "n", "0");
+    parser.addOption(reconstruction_threads_option);
+    QCommandLineOption depth_option("pipeline-depth",
+                                    "Restored tasks allowed to wait for a worker.", "n", "1");
+    parser.addOption(depth_option);
+    parser.addPositionalArgument("tasks", "The .task files to reconstruct.", "<task>...");
+    parser.process(arguments);
+
+    bool ok = false;
+    const int num_workers = parser.value(workers_option).toInt(&ok);
+    if (!ok || num_workers <= 0) {
+        std::cerr << "Invalid number of workers: "
+                  << parser.value(workers_option).toStdString() << std::endl;
+        return 2;
+    }
+    const int restoration_threads = parser.value(restoration_threads_option).toInt(&ok);
+    if (!ok || restoration_threads < 0) {
+        std::cerr << "Invalid number of restoration threads: "
+                  << parser.value(restoration_threads_option).toStdString() << std::endl;
+        return 2;
+    }
+    int reconstruction_threads = parser.value(reconstruction_threads_option).toInt(&ok);
+    if (!ok || reconstruction_threads < 0) {
+        std::cerr << "Invalid number of reconstruction threads: "
+                  << parser.value(reconstruction_threads_option).toStdString() << std::endl;
+        return 2;
+    }
+    const int pipeline_depth = parser.value(depth_option).toInt(&ok);
+    if (!ok || pipeline_depth <= 0) {
+        std::cerr << "Invalid pipeline depth: " << parser.value(depth_option).toStdString() << std::endl;
+        return 2;
+    }
+    const QStringList task_paths = parser.positionalArguments();
+    if (task_paths.isEmpty()) {
+        std::cerr << "No task file given." << std::endl;
+        return 2;
+    }
+    QString output_dir = parser.value(output_option);
+    if (!output_dir.isEmpty()) {
+        output_dir = QDir(output_dir).absolutePath();
+        QDir().mkpath(output_dir);
+    }
+
+    // The stages get separate thread budgets, so that restoring the next
+    // task does not slow down the reconstructions running meanwhile.
+    OrtSessionCache& session_cache = SpectEngine::Instance().GetSessionCache();
+    if (restoration_threads > 0) {
+        SessionConfig session_config = session_cache.GetDefaultConfig();
+        session_config.intra_op_num_threads = restoration_threads;
+        session_cache.SetDefaultConfig(session_config);
+    } else {
+        SpectEngine::Instance().SetDefaultRestorationThreads(std::max(1, GetHardwareThreadCount() / 4));
+    }
+    const SessionConfig session_config = session_cache.GetDefaultConfig();
+    if (reconstruction_threads == 0) {
+        reconstruction_threads = std::max(1, (GetHardwareThreadCount()
+                                              - session_config.intra_op_num_threads) / num_workers);
+    }
+
+    BatchRunner runner(task_paths, nullptr);
+    runner.SetNumWorkers(num_workers);
+    runner.SetReconstructionThreads(reconstruction_threads);
+    runner.SetPipelineDepth(pipeline_depth);
+    runner.SetOutputDir(output_dir);
+    QObject::connect(&runner, &BatchRunner::Finished, [](int num_failed) {
+        QCoreApplication::exit(num_failed == 0 ? 0 : 1);
+    });
+    // Started from the event loop so that Finished() can always exit it.
+    QTimer::singleShot(0, &runner, &BatchRunner::Start);
+    const int rv = QCoreApplication::exec();
+    // Restored sinograms may still be on their way to disk.
+    SpectEngine::Instance().GetIoThread().Flush();
+    return rv;
+}
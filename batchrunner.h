@@ -0,0 +1,97 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QStringList>
+
+#include "recontaskparameter.h"
+#include "reconthread.h"
+
+// Runs .task files without a GUI, a bounded number at a time, through the
+// same ReconThread pipeline as the main window. The final result of every
+// task is written as raw float32 next to the library outputs, together with
+// a .task file holding the results.
+//
+// Tasks go through two stages. A preparation thread loads the tasks in order
+// and restores their sinograms, while the workers reconstruct the tasks
+// prepared before, so that restoration of the next task overlaps with
+// reconstruction of the current one. At most `pipeline_depth` prepared
+// tasks wait for a worker, which bounds the memory held by the queue.
+class BatchRunner : public QObject
+{
+    Q_OBJECT
+public:
+    BatchRunner(const QStringList& task_paths, QObject *parent);
+    ~BatchRunner();
+
+    void SetNumWorkers(int num_workers);
+    // Threads of the reconstruction of one task. Zero or less shares all
+    // hardware threads among the workers.
+    void SetReconstructionThreads(int num_threads) {
+        reconstruction_threads_ = num_threads;
+    }
+    void SetPipelineDepth(int pipeline_depth);
+    // Overrides the output directory of every task when not empty.
+    void SetOutputDir(const QString& output_dir) {
+        output_dir_ = output_dir;
+    }
+    // Finished() is emitted once every task has been run.
+    void Start();
+
+signals:
+    void Finished(int num_failed);
+    // Emitted from the preparation thread when a task is ready.
+    void JobPrepared();
+
+private:
+    struct Job {
+        QString path;
+        // Loaded by the preparation stage and released once it is written.
+        ReconTaskParameter param;
+        ReconThread *thread = nullptr;
+        QElapsedTimer timer;
+        qint64 load_ms = 0;
+        qint64 restoration_ms = 0;
+        // Error of the preparation, 0 if it succeeded.
+        int prepare_status = 0;
+        ReconThread::SharedRestoredSinogram restored;
+    };
+    // Body of the preparation thread.
+    void Prepare_();
+    void PrepareJob_(Job& job);
+    void Dispatch_();
+    void OnJobFinished_(size_t job_index);
+    int StartJob_(Job& job);
+    int WriteResults_(Job& job, qint64 *write_ms);
+
+    std::vector<Job> jobs_;
+    QString output_dir_;
+    int num_workers_ = 1;
+    int reconstruction_threads_ = 0;
+    size_t pipeline_depth_ = 1;
+    // Guards the counters shared with the preparation thread.
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t num_prepared_ = 0;
+    bool stopping_ = false;
+    std::thread prepare_thread_;
+    // Wall time each stage was busy, to compare with the total.
+    qint64 preparation_busy_ms_ = 0;
+    qint64 reconstruction_busy_ms_ = 0;
+    size_t next_job_ = 0;
+    int num_running_ = 0;
+    int num_failed_ = 0;
+    QElapsedTimer timer_;
+};
+
+// Entry point of `--batch`. Parses the command line of the running
+// QCoreApplication and returns the process exit code.
+int RunBatch(const QStringList& arguments);
+
+#endif // BATCHRUNNER_H
@@ -0,0 +1,157 @@
+#include "checkpoint.h"
+
+#include <QFile>
+
+namespace {
+
+const quint32 kCheckpointMagic = 0x53524b43; // "SRKC"
+const quint32 kCheckpointVersion = 1;
+const quint32 kRecordMagic = 0x534c4345; // "SLCE"
+
+template <typename T>
+bool Read(QFile& file, T *value)
+{
+    return file.read(reinterpret_cast<char *>(value), sizeof(T)) == sizeof(T);
+}
+
+template <typename T>
+void Write(QFile& file, const T& value)
+{
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+} // namespace
+
+CheckpointWriter::CheckpointWriter(const QString &path, const CheckpointHeader &header):
+    path_(path),
+    header_(header)
+{
+    thread_ = std::thread([this]() { Run_(); });
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+}
+
+void CheckpointWriter::Append(int slice_index, const std::vector<std::vector<double> > &snapshots)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records_.push_back(Record{slice_index, snapshots});
+    }
+    cv_.notify_one();
+}
+
+void CheckpointWriter::Discard()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+        discarded_ = true;
+        records_.clear();
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+    thread_ = std::thread();
+    QFile::remove(path_);
+}
+
+void CheckpointWriter::Run_()
+{
+    QFile file(path_);
+    bool opened = false;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stopped_ || !records_.empty(); });
+        if (discarded_) return;
+        if (records_.empty()) return;
+        Record record = std::move(records_.front());
+        records_.pop_front();
+        lock.unlock();
+
+        if (!opened) {
+            // The file is only created once there is something to resume.
+            opened = file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+            if (opened) {
+                Write(file, kCheckpointMagic);
+                Write(file, kCheckpointVersion);
+                Write(file, static_cast<quint32>(header_.fingerprint.size()));
+                file.write(header_.fingerprint);
+                Write(file, static_cast<qint32>(header_.num_iters_done));
+                Write(file, static_cast<qint32>(header_.snapshot_interval));
+            }
+        }
+        if (opened) {
+            Write(file, kRecordMagic);
+            Write(file, static_cast<qint32>(record.slice_index));
+            Write(file, static_cast<quint32>(record.snapshots.size()));
+            for (const auto& snapshot: record.snapshots) {
+                Write(file, static_cast<quint64>(snapshot.size()));
+                file.write(reinterpret_cast<const char *>(snapshot.data()),
+                           static_cast<qint64>(snapshot.size() * sizeof(double)));
+            }
+            file.flush();
+        }
+        lock.lock();
+    }
+}
+
+int ReadCheckpoint(const QString &path, const CheckpointHeader &header, CheckpointSlices *slices)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return -1;
+    quint32 magic = 0, version = 0, fingerprint_size = 0;
+    qint32 num_iters_done = 0, snapshot_interval = 0;
+    if (!Read(file, &magic) || magic != kCheckpointMagic
+            || !Read(file, &version) || version != kCheckpointVersion
+            || !Read(file, &fingerprint_size)
+            || fingerprint_size != static_cast<quint32>(header.fingerprint.size())
+            || file.read(fingerprint_size) != header.fingerprint
+            || !Read(file, &num_iters_done) || num_iters_done != header.num_iters_done
+            || !Read(file, &snapshot_interval) || snapshot_interval != header.snapshot_interval) {
+        return -1;
+    }
+    // One snapshot every interval, and one more for the final iteration.
+    const quint64 max_snapshots = num_iters_done > 0 && snapshot_interval > 0
+            ? static_cast<quint64>(num_iters_done / snapshot_interval + 1) : 0;
+    int num_slices = 0;
+    while (true) {
+        qint32 slice_index = 0;
+        quint32 num_snapshots = 0;
+        if (!Read(file, &magic) || magic != kRecordMagic
+                || !Read(file, &slice_index) || !Read(file, &num_snapshots)) {
+            break;
+        }
+        // Every snapshot starts with its size, so a count that does not fit
+        // the header or the rest of the file is not trusted with an
+        // allocation.
+        const quint64 remaining = static_cast<quint64>(file.size() - file.pos());
+        if (num_snapshots > max_snapshots
+                || static_cast<quint64>(num_snapshots) * sizeof(quint64) > remaining) {
+            slices->clear();
+            return -1;
+        }
+        std::vector<std::vector<double> > snapshots(num_snapshots);
+        bool ok = true;
+        for (auto& snapshot: snapshots) {
+            quint64 size = 0;
+            ok = Read(file, &size)
+                    && size <= static_cast<quint64>(file.size() - file.pos()) / sizeof(double);
+            if (!ok) break;
+            snapshot.resize(size);
+            const qint64 num_bytes = static_cast<qint64>(size * sizeof(double));
+            ok = file.read(reinterpret_cast<char *>(snapshot.data()), num_bytes) == num_bytes;
+            if (!ok) break;
+        }
+        if (!ok) break;
+        (*slices)[slice_index] = std::move(snapshots);
+        ++num_slices;
+    }
+    return num_slices;
+}
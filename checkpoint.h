@@ -0,0 +1,61 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QByteArray>
+#include <QString>
+
+// The header of a checkpoint, which a resumed run has to match.
+struct CheckpointHeader {
+    QByteArray fingerprint;
+    int num_iters_done = 0;
+    int snapshot_interval = 0;
+};
+
+// Snapshots of the completed slices of a run, by slice index.
+typedef std::map<int, std::vector<std::vector<double> > > CheckpointSlices;
+
+// Appends completed slices to a checkpoint file on a background thread so
+// that the reconstruction never waits for the disk. The file is a header
+// followed by one record per slice; a record cut short by a crash is
+// ignored when the file is read back.
+class CheckpointWriter
+{
+public:
+    CheckpointWriter(const QString& path, const CheckpointHeader& header);
+    // Writes out everything appended so far.
+    ~CheckpointWriter();
+
+    void Append(int slice_index, const std::vector<std::vector<double> >& snapshots);
+    // Stops writing and deletes the file, for runs that completed.
+    void Discard();
+
+private:
+    struct Record {
+        int slice_index;
+        std::vector<std::vector<double> > snapshots;
+    };
+    void Run_();
+
+    QString path_;
+    CheckpointHeader header_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Record> records_;
+    bool stopped_ = false;
+    bool discarded_ = false;
+    std::thread thread_;
+};
+
+// Reads the checkpoint at `path` into `slices` if its header matches
+// `header`. Returns the number of slices read, or -1, with `slices` left
+// empty, if there is no usable checkpoint.
+int ReadCheckpoint(const QString& path, const CheckpointHeader& header, CheckpointSlices *slices);
+
+#endif // CHECKPOINT_H
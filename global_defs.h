@@ -4,10 +4,17 @@
 #include <QString>
 #include <QDir>
 
-// Constant values used by neural networks for restoration.
+// Slice geometry the restoration network is trained on. Other geometries
+// are adapted to it on the way through the network.
 const int kNumDetectors = 128;
 const int kNumAngles = 120;
 const int kNumSlices = 16;
+// Slices shared by neighbouring restoration windows, and the number of
+// windows restored per network run when the model allows batching.
+const int kRestorationOverlap = 8;
+const int kRestorationMaxBatchSize = 4;
+// How long a restoration window may wait for others to share its batch.
+const int kRestorationMaxDelayMs = 5;
 
 const QString kBaseDir = QDir::home().filePath("spect-recon-data");
 
@@ -0,0 +1,98 @@
+#include "inferenceservice.h"
+
+#include <algorithm>
+
+InferenceService::InferenceService(std::shared_ptr<Ort::Session> session,
+                                   size_t max_batch_size, int max_delay_ms):
+    session_(session),
+    net_(session, max_batch_size),
+    max_delay_(max_delay_ms)
+{
+    batch_windows_.resize(net_.GetMaxBatchSize());
+    batch_output_.resize(net_.GetMaxBatchSize() * net_.GetWindowSize());
+    batch_norms_.resize(net_.GetMaxBatchSize());
+    thread_ = std::thread([this]() { Run_(); });
+}
+
+InferenceService::~InferenceService()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+std::future<void> InferenceService::Submit(const float *input, float *output, double *norm)
+{
+    Request request{input, output, norm, std::promise<void>(), Clock::now()};
+    std::future<void> future = request.done.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requests_.push_back(std::move(request));
+    }
+    cv_.notify_one();
+    return future;
+}
+
+InferenceService::Metrics InferenceService::GetMetrics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return metrics_;
+}
+
+void InferenceService::Run_()
+{
+    const size_t max_batch_size = net_.GetMaxBatchSize();
+    const size_t window_size = net_.GetWindowSize();
+    std::vector<Request> batch;
+    batch.reserve(max_batch_size);
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stopping_ || !requests_.empty(); });
+        if (requests_.empty()) return;
+        // Give other tasks until the deadline of the oldest window to join.
+        const Clock::time_point deadline = requests_.front().submit_time + max_delay_;
+        cv_.wait_until(lock, deadline, [&]() {
+            return stopping_ || requests_.size() >= max_batch_size;
+        });
+        const size_t batch_size = std::min(max_batch_size, requests_.size());
+        const Clock::time_point start_time = Clock::now();
+        for (size_t i = 0; i < batch_size; ++i) {
+            Request& request = requests_.front();
+            const double latency_ms = std::chrono::duration<double, std::milli>(
+                        start_time - request.submit_time).count();
+            total_queue_latency_ms_ += latency_ms;
+            metrics_.max_queue_latency_ms = std::max(metrics_.max_queue_latency_ms, latency_ms);
+            batch.push_back(std::move(request));
+            requests_.pop_front();
+        }
+        metrics_.num_requests += batch_size;
+        ++metrics_.num_batches;
+        metrics_.mean_queue_latency_ms = total_queue_latency_ms_ / metrics_.num_requests;
+        lock.unlock();
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            batch_windows_[i] = batch[i].input;
+        }
+        std::exception_ptr error;
+        try {
+            net_.RunBatch(batch_windows_.data(), batch_size, batch_output_.data(), batch_norms_.data());
+        } catch (...) {
+            error = std::current_exception();
+        }
+        for (size_t i = 0; i < batch_size; ++i) {
+            if (error) {
+                batch[i].done.set_exception(error);
+                continue;
+            }
+            std::copy(batch_output_.cbegin() + i * window_size,
+                      batch_output_.cbegin() + (i + 1) * window_size, batch[i].output);
+            *batch[i].norm = batch_norms_[i];
+            batch[i].done.set_value();
+        }
+        batch.clear();
+        lock.lock();
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef INFERENCESERVICE_H
+#define INFERENCESERVICE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "scascnet.h"
+
+// Serves restoration windows of one model to every task running at the same
+// time. Windows submitted from any thread are collected for up to
+// `max_delay_ms` or until `max_batch_size` of them are waiting, restored in
+// one batched network run on the dispatcher thread and handed back through
+// futures.
+class InferenceService
+{
+public:
+    struct Metrics {
+        long long num_requests = 0;
+        long long num_batches = 0;
+        // Time between submission and the start of the batch.
+        double mean_queue_latency_ms = 0.;
+        double max_queue_latency_ms = 0.;
+        double GetMeanBatchSize() const {
+            return num_batches > 0 ? static_cast<double>(num_requests) / num_batches : 0.;
+        }
+    };
+
+    InferenceService(std::shared_ptr<Ort::Session> session, size_t max_batch_size, int max_delay_ms);
+    // Finishes the windows already submitted.
+    ~InferenceService();
+
+    bool IsServing(const std::shared_ptr<Ort::Session>& session) const {
+        return session == session_;
+    }
+    size_t GetNumSlices() const { return net_.GetNumSlices(); }
+    size_t GetNumAngles() const { return net_.GetNumAngles(); }
+    size_t GetNumDetectors() const { return net_.GetNumDetectors(); }
+    size_t GetWindowSize() const { return net_.GetWindowSize(); }
+    size_t GetMaxBatchSize() const { return net_.GetMaxBatchSize(); }
+
+    // Queues the window at `input`, which is read in place. Once the future
+    // is ready, its restoration is in `output` and the mean of the input in
+    // `norm`. Both buffers must stay alive until then.
+    std::future<void> Submit(const float* input, float* output, double* norm);
+    Metrics GetMetrics() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+    struct Request {
+        const float* input;
+        float* output;
+        double* norm;
+        std::promise<void> done;
+        Clock::time_point submit_time;
+    };
+    void Run_();
+
+    std::shared_ptr<Ort::Session> session_;
+    // Only used by the dispatcher thread.
+    Scascnet net_;
+    std::vector<const float*> batch_windows_;
+    std::vector<float> batch_output_;
+    std::vector<double> batch_norms_;
+
+    const std::chrono::milliseconds max_delay_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Request> requests_;
+    bool stopping_ = false;
+    Metrics metrics_;
+    double total_queue_latency_ms_ = 0.;
+    std::thread thread_;
+};
+
+#endif // INFERENCESERVICE_H
@@ -0,0 +1,48 @@
+#include "iothread.h"
+
+IoThread::IoThread()
+{
+    thread_ = std::thread([this]() { Run_(); });
+}
+
+IoThread::~IoThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+void IoThread::Post(std::function<void ()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+}
+
+void IoThread::Flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this]() { return jobs_.empty() && !busy_; });
+}
+
+void IoThread::Run_()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stopped_ || !jobs_.empty(); });
+        if (jobs_.empty()) return;
+        std::function<void()> job = std::move(jobs_.front());
+        jobs_.pop_front();
+        busy_ = true;
+        lock.unlock();
+        job();
+        lock.lock();
+        busy_ = false;
+        if (jobs_.empty()) idle_cv_.notify_all();
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef IOTHREAD_H
+#define IOTHREAD_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// A background thread running file writes one after another, off the
+// critical path of the reconstruction. Whatever a job reads must be owned
+// by the job, e.g. through a shared pointer to immutable data.
+class IoThread
+{
+public:
+    IoThread();
+    // Runs the jobs still queued before returning.
+    ~IoThread();
+
+    void Post(std::function<void()> job);
+    // Blocks until every job posted so far has run.
+    void Flush();
+
+private:
+    void Run_();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()> > jobs_;
+    bool busy_ = false;
+    bool stopped_ = false;
+    std::thread thread_;
+};
+
+#endif // IOTHREAD_H
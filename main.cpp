@@ -1,13 +1,39 @@
 #include "mainwindow.h"
 
 #include <QApplication>
+#include <QCoreApplication>
 #include <QLocale>
 #include <QTranslator>
 
+#include "batchrunner.h"
+#include "restorationbenchmark.h"
+#include "restorationcheck.h"
 #include "scascnet.h"
+#include "sessionbenchmark.h"
 
 int main(int argc, char *argv[])
 {
+    // Batch and benchmark modes must not touch the GUI, so they are chosen
+    // before any QApplication exists.
+    for (int i = 1; i < argc; ++i) {
+        if (QString(argv[i]) == "--batch") {
+            QCoreApplication app(argc, argv);
+            return RunBatch(app.arguments());
+        }
+        if (QString(argv[i]) == "--benchmark-session") {
+            QCoreApplication app(argc, argv);
+            return RunSessionBenchmark(app.arguments());
+        }
+        if (QString(argv[i]) == "--benchmark-restoration") {
+            QCoreApplication app(argc, argv);
+            return RunRestorationBenchmark(app.arguments());
+        }
+        if (QString(argv[i]) == "--check-restoration") {
+            QCoreApplication app(argc, argv);
+            return RunRestorationCheck(app.arguments());
+        }
+    }
+
     QApplication a(argc, argv);
 
     QTranslator translator;
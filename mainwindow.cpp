@@ -1,16 +1,20 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 
+#include <algorithm>
+
 #include <QDebug>
 #include <QRegExp>
 #include <QMessageBox>
 #include <QDir>
 #include <QFileDialog>
+#include <QInputDialog>
 
 #include "global_defs.h"
 #include "error_code.h"
 #include "reconthread.h"
 #include "sinogramfilereader.h"
+#include "threadbudget.h"
 #include "utils.h"
 
 QString MainWindow::base_dir_ = kBaseDir;
@@ -27,10 +31,8 @@ MainWindow::MainWindow(QWidget *parent)
     progress_bar_->setValue(0);
     ui->statusbar->addPermanentWidget(progress_bar_, 0);
 
-    timer_ = new QTimer(this);
-    timer_->setInterval(200);
-    connect(timer_, SIGNAL(timeout()), this, SLOT(CheckStatus()));
-    timer_->start();
+    scheduler_ = new ReconScheduler(this);
+    connect(scheduler_, &ReconScheduler::TaskStateChanged, this, &MainWindow::TaskStateChanged);
 }
 
 MainWindow::~MainWindow()
@@ -57,8 +59,12 @@ void MainWindow::on_actionExit_triggered()
 
 void MainWindow::ParamChanged_()
 {
+    // Status only changes on edits and task events, so refresh it here
+    // rather than polling.
+    UpdateStatusBar_();
+    UpdateControlButtons_();
     ui->pushButtonSave->setEnabled(true);
-    if (CurrentTask_().GetStatus() != ReconTask::Status::kRunning) {
+    if (!CurrentTask_().IsActive()) {
         ui->pushButtonRun->setEnabled(true);
         ui->actionRun_All_Tasks->setEnabled(true);
     }
@@ -78,6 +84,8 @@ void MainWindow::SetEditable_(bool editable)
     ui->comboBoxIterator->setEnabled(editable);
 
     ui->checkBoxRestore->setEnabled(editable);
+    ui->comboBoxModelPrecision->setEnabled(editable);
+    ui->comboBoxRestoredOutput->setEnabled(editable);
     ui->checkBoxScatterMap->setEnabled(editable);
 
     ui->pushButtonSelectSysMat->setEnabled(editable);
@@ -96,6 +104,11 @@ void MainWindow::SetEditable_(bool editable)
     ui->lineEditNumDetectors->setEnabled(editable);
 
     ui->comboBoxFilter->setEnabled(editable);
+
+    ui->checkBoxVolume->setEnabled(editable);
+    bool volume = editable && ui->checkBoxVolume->isChecked();
+    ui->lineEditSliceBegin->setEnabled(volume);
+    ui->lineEditSliceEnd->setEnabled(volume);
 }
 
 QString GetLabelStringFromDataType(recontaskparameter_pb::ReconTaskParameterPB_FileDataType data_type) {
@@ -159,9 +172,17 @@ void MainWindow::UpdateParameterDisplay_()
 
     if (param.use_nn) ui->checkBoxRestore->setCheckState(Qt::Checked);
     else ui->checkBoxRestore->setCheckState(Qt::Unchecked);
+    ui->comboBoxModelPrecision->setCurrentIndex(static_cast<int>(param.model_precision));
+    ui->comboBoxRestoredOutput->setCurrentIndex(static_cast<int>(param.restored_output));
 
     if (param.use_scatter_map) ui->checkBoxScatterMap->setCheckState(Qt::Checked);
     else ui->checkBoxScatterMap->setCheckState(Qt::Unchecked);
+
+    ui->checkBoxVolume->setCheckState(param.reconstruct_volume ? Qt::Checked : Qt::Unchecked);
+    ui->lineEditSliceBegin->setText(QString::number(param.slice_begin));
+    ui->lineEditSliceEnd->setText(param.slice_end < 0 ? QString() : QString::number(param.slice_end - 1));
+    ui->lineEditSliceBegin->setEnabled(param.reconstruct_volume);
+    ui->lineEditSliceEnd->setEnabled(param.reconstruct_volume);
     ui->lineEditScatterMap->setEnabled(param.use_scatter_map);
     ui->pushButtonSelectScatterMap->setEnabled(param.use_scatter_map);
     ui->lineEditOutputDir->setText(param.output_dir);
@@ -197,8 +218,9 @@ void MainWindow::UpdateParameterDisplay_()
         ui->labelSinogramImage->setText("Sinograms Preview");
     }
 
-    if (current_task.GetStatus() == ReconTask::Status::kCompleted) {
+    if (current_task.HasResult()) {
         ui->pushButtonShowResult->setEnabled(true);
+        ui->pushButtonShowVolume->setEnabled(true);
         SetLabelImage(*ui->labelResultImage, current_task.GetPixmapResult(0));
         const vector<int>& result_iter_index_array = current_task.GetResultIterIndexArray();
         ui->comboBoxResult->addItem(tr("Final Result"));
@@ -211,6 +233,7 @@ void MainWindow::UpdateParameterDisplay_()
         ui->horizontalScrollBarResult->setEnabled(true);
     } else {
         ui->pushButtonShowResult->setEnabled(false);
+        ui->pushButtonShowVolume->setEnabled(false);
         ui->labelResultImage->clear();
         ui->labelResultImage->setText("Result Preview");
         ui->horizontalScrollBarResult->setEnabled(false);
@@ -228,6 +251,7 @@ void MainWindow::CreateNewTask_()
 {
     task_array_.emplace_back(new ReconTask(this));
     connect(task_array_.back(), &ReconTask::TaskCompleted, this, &MainWindow::TaskCompleted);
+    connect(task_array_.back(), &ReconTask::ProgressChanged, this, &MainWindow::TaskProgressChanged);
     ui->listWidgetTask->addItem("untitled task");
     ui->listWidgetTask->setCurrentRow(ui->listWidgetTask->count() - 1);
     UpdateParameterDisplay_();
@@ -251,8 +275,33 @@ void MainWindow::UpdateStatusBar_() {
             progress_bar_->setValue(100);
             break;
         }
+        case Status::kQueued: {
+            text = "Waiting for other tasks to finish...";
+            progress_bar_->setVisible(true);
+            progress_bar_->setValue(0);
+            break;
+        }
         case Status::kRunning: {
+            const ReconTask& task = CurrentTask_();
             text = "Running Reconstruction...";
+            if (task.GetMsPerIteration() > 0) {
+                text += QString(" %1 ms/iter").arg(task.GetMsPerIteration());
+            }
+            if (task.GetEtaMs() >= 0) {
+                text += QString(", about %1 s left").arg((task.GetEtaMs() + 999) / 1000);
+            }
+            progress_bar_->setVisible(true);
+            progress_bar_->setValue(task.GetProgress());
+            break;
+        }
+        case Status::kPaused: {
+            text = "Paused. Press Resume to continue.";
+            progress_bar_->setVisible(true);
+            progress_bar_->setValue(CurrentTask_().GetProgress());
+            break;
+        }
+        case Status::kCancelled: {
+            text = "Reconstruction cancelled.";
             progress_bar_->setVisible(true);
             progress_bar_->setValue(CurrentTask_().GetProgress());
             break;
@@ -278,6 +327,22 @@ void MainWindow::on_actionNew_Task_triggered()
     UpdateStatusBar_();
 }
 
+void MainWindow::on_actionDuplicate_Task_triggered()
+{
+    if (GetTaskCount_() == 0) return;
+    // Tasks are held by pointer, so the source outlives the new one.
+    const ReconTask& source = CurrentTask_();
+    CreateNewTask_();
+    ReconTask& task = CurrentTask_();
+    task.CopyInputFrom(source);
+    task.GetParameter().task_name = source.GetTaskName() + "_copy";
+    UpdateParameterDisplay_();
+    UpdateComboBoxProjectionIndex_();
+    UpdateComboBoxSinogramIndex_();
+    UpdateTaskListItem_(CurrentTaskIndex_());
+    UpdateStatusBar_();
+}
+
 
 void MainWindow::on_listWidgetTask_currentRowChanged(int currentRow)
 {
@@ -313,12 +378,123 @@ void MainWindow::on_checkBoxRestore_stateChanged(int arg1)
     ParamChanged_();
 }
 
+void MainWindow::on_comboBoxModelPrecision_currentIndexChanged(int index)
+{
+    if (GetTaskCount_() == 0 || index < 0) return;
+    GetCurrentParameter_().model_precision = static_cast<ReconTaskParameter::ModelPrecision>(index);
+    ParamChanged_();
+}
+
+void MainWindow::on_comboBoxRestoredOutput_currentIndexChanged(int index)
+{
+    if (GetTaskCount_() == 0 || index < 0) return;
+    GetCurrentParameter_().restored_output = static_cast<ReconTaskParameter::RestoredOutput>(index);
+    ParamChanged_();
+}
+
 void MainWindow::on_lineEditTaskName_textChanged(const QString &arg1)
 {
-    ui->listWidgetTask->currentItem()->setText(arg1);
+    Q_UNUSED(arg1);
+    UpdateTaskListItem_(CurrentTaskIndex_());
     ParamChanged_();
 }
 
+void MainWindow::UpdateTaskListItem_(int task_index)
+{
+    using Status = ReconTask::Status;
+    if (task_index < 0 || task_index >= GetTaskCount_()) return;
+    QListWidgetItem *item = ui->listWidgetTask->item(task_index);
+    if (item == nullptr) return;
+    // The name being edited is shown before it is committed to the parameter.
+    QString text = task_index == CurrentTaskIndex_() ? ui->lineEditTaskName->text()
+                                                     : GetParameter_(task_index).task_name;
+    switch (task_array_[task_index]->GetStatus()) {
+    case Status::kQueued: {
+        text += tr(" [Queued]");
+        break;
+    }
+    case Status::kRunning: {
+        text += tr(" [Running %1%]").arg(task_array_[task_index]->GetProgress());
+        break;
+    }
+    case Status::kPaused: {
+        text += tr(" [Paused]");
+        break;
+    }
+    case Status::kCancelled: {
+        text += tr(" [Cancelled]");
+        break;
+    }
+    case Status::kCompleted: {
+        text += tr(" [Finished]");
+        break;
+    }
+    case Status::kFailedToReconstruct: {
+        text += tr(" [Failed]");
+        break;
+    }
+    default:
+        break;
+    }
+    item->setText(text);
+}
+
+void MainWindow::TaskStateChanged(ReconTask *recon_task)
+{
+    auto it = std::find(task_array_.begin(), task_array_.end(), recon_task);
+    if (it == task_array_.end()) return;
+    UpdateTaskListItem_(static_cast<int>(it - task_array_.begin()));
+    if (&CurrentTask_() == recon_task) {
+        UpdateStatusBar_();
+        UpdateControlButtons_();
+        if (recon_task->HasResult()) {
+            ui->pushButtonShowResult->setEnabled(true);
+            ui->pushButtonShowVolume->setEnabled(true);
+        }
+        ui->pushButtonRun->setEnabled(!recon_task->IsActive());
+    }
+}
+
+void MainWindow::TaskProgressChanged(ReconTask *recon_task)
+{
+    auto it = std::find(task_array_.begin(), task_array_.end(), recon_task);
+    if (it == task_array_.end()) return;
+    UpdateTaskListItem_(static_cast<int>(it - task_array_.begin()));
+    if (&CurrentTask_() == recon_task) UpdateStatusBar_();
+}
+
+void MainWindow::UpdateControlButtons_()
+{
+    if (GetTaskCount_() == 0) {
+        ui->pushButtonPause->setEnabled(false);
+        ui->pushButtonCancel->setEnabled(false);
+        return;
+    }
+    const ReconTask::Status status = CurrentTask_().GetStatus();
+    ui->pushButtonPause->setEnabled(status == ReconTask::Status::kRunning
+                                    || status == ReconTask::Status::kPaused);
+    ui->pushButtonPause->setText(status == ReconTask::Status::kPaused ? tr("Resume") : tr("Pause"));
+    ui->pushButtonCancel->setEnabled(CurrentTask_().IsActive());
+}
+
+void MainWindow::on_pushButtonPause_clicked()
+{
+    ReconTask& current_task = CurrentTask_();
+    if (current_task.GetStatus() == ReconTask::Status::kPaused) {
+        current_task.Resume();
+    } else {
+        current_task.Pause();
+    }
+    TaskStateChanged(&current_task);
+}
+
+void MainWindow::on_pushButtonCancel_clicked()
+{
+    ReconTask& current_task = CurrentTask_();
+    scheduler_->Cancel(&current_task);
+    TaskStateChanged(&current_task);
+}
+
 
 void MainWindow::on_lineEditTaskName_editingFinished()
 {
@@ -584,8 +760,10 @@ void MainWindow::on_pushButtonSelectSinogram_clicked()
         num_angles = shape_sinogram[1];
         num_detectors = shape_sinogram[2];
 
-        recon_param.sinogram = reader.GetSinogram();
-        recon_param.projection = reader.GetProjection();
+        auto data = std::make_shared<ReconTaskData>();
+        data->sinogram = reader.GetSinogram();
+        data->projection = reader.GetProjection();
+        recon_param.data = data;
         recon_param.sinogram_info = sinogram_info;
         recon_param.num_slices = num_slices;
         recon_param.num_angles = num_angles;
@@ -685,13 +863,25 @@ void MainWindow::on_actionImport_Tasks_triggered()
     auto& current_task = CurrentTask_();
     auto& param = GetCurrentParameter_();
     param.FromProtobufFilePath(path);
-    if (param.sinogram.shape().size()) {
-        current_task.SetPixmapSinogramArray(GetPixmapArrayFromTensor3D(param.sinogram));
-        current_task.SetPixmapProjectionArray(GetPixmapArrayFromTensor3D(param.projection));
+    if (param.data->sinogram.shape().size()) {
+        current_task.SetPixmapSinogramArray(GetPixmapArrayFromTensor3D(param.data->sinogram));
+        current_task.SetPixmapProjectionArray(GetPixmapArrayFromTensor3D(param.data->projection));
     }
     UpdateParameterDisplay_();
     UpdateComboBoxProjectionIndex_();
     UpdateComboBoxSinogramIndex_();
+    // Offer to pick up where a crashed or cancelled session stopped.
+    if (current_task.HasCheckpoint()) {
+        auto answer = QMessageBox::question(
+                    this, tr("Resume Task"),
+                    tr("An interrupted run of %1 left a checkpoint. Resume it now?")
+                    .arg(current_task.GetTaskName()));
+        if (answer == QMessageBox::Yes) {
+            current_task.SetResumeFromCheckpoint(true);
+            scheduler_->Enqueue(&current_task, 1);
+            UpdateStatusBar_();
+        }
+    }
 }
 
 void MainWindow::RunTask_(int task_index)
@@ -702,8 +892,18 @@ void MainWindow::RunTask_(int task_index)
     ui->horizontalScrollBarResult->setEnabled(false);
     ui->comboBoxResult->setEnabled(false);
     ui->pushButtonShowResult->setEnabled(false);
-
-    task_array_[task_index]->Start();
+    ui->pushButtonShowVolume->setEnabled(false);
+
+    ReconTask *task = task_array_[task_index];
+    if (!task->IsActive() && task->HasCheckpoint()) {
+        auto answer = QMessageBox::question(
+                    this, tr("Resume Task"),
+                    tr("An interrupted run of %1 left a checkpoint. Resume from it?")
+                    .arg(task->GetTaskName()));
+        task->SetResumeFromCheckpoint(answer == QMessageBox::Yes);
+    }
+    // A task started by hand goes ahead of the ones queued by Run All Tasks.
+    scheduler_->Enqueue(task, 1);
     UpdateStatusBar_();
 }
 
@@ -718,7 +918,9 @@ void MainWindow::on_comboBoxIterator_currentTextChanged(const QString &arg1)
 void MainWindow::RunAllTask_()
 {
     for (auto& task: task_array_) {
-        task->Start();
+        // Checkpoints that no longer match the task are ignored by the run.
+        if (!task->IsActive()) task->SetResumeFromCheckpoint(task->HasCheckpoint());
+        scheduler_->Enqueue(task);
     }
     UpdateStatusBar_();
 }
@@ -748,7 +950,7 @@ void MainWindow::on_horizontalScrollBarProjection_valueChanged(int value)
 
 void MainWindow::DrawProjectionLine_() {
     ReconTask& current_task = CurrentTask_();
-    int num_detectors = current_task.GetParameter().sinogram.shape()[2];
+    int num_detectors = current_task.GetParameter().data->sinogram.shape()[2];
     QImage projection_image_buffer_ = current_task.GetCurrentPixmapProjection().toImage();
     int index_sinogram = current_task.GetParameter().index_sinogram;
     for (int i = 0; i < num_detectors; ++i) {
@@ -763,17 +965,24 @@ void MainWindow::DrawProjectionLine_() {
 void MainWindow::on_pushButtonShowResult_clicked()
 {
     ReconTask& current_task = CurrentTask_();
-    ReconTaskParameter& param = current_task.GetParameter();
-    QVector<QPixmap> pixmap_array;
-    for (const auto& result: current_task.GetResultArray()) {
-        pixmap_array.push_back(GetPixmapFromTensor2D(result));
-    }
-    ResultDialog *result_dialog = new ResultDialog(pixmap_array,
-                                                   GetPixmapFromTensor2D(param.sinogram_used_to_reconstruct),
+    ResultDialog *result_dialog = new ResultDialog(current_task.GetPixmapResultArray(),
+                                                   current_task.GetPixmapSinogramUsed(),
                                                    this);
     result_dialog->exec();
 }
 
+void MainWindow::on_pushButtonShowVolume_clicked()
+{
+    Tensor volume = CurrentTask_().GetResultVolume();
+    if (volume.shape().size() != 3) {
+        ShowMessageBox(tr("No reconstructed volume is available."));
+        return;
+    }
+    VolumeViewer *volume_viewer = new VolumeViewer(volume, this);
+    volume_viewer->setAttribute(Qt::WA_DeleteOnClose);
+    volume_viewer->show();
+}
+
 void MainWindow::TaskCompleted(ReconTask *recon_task)
 {
     if (&CurrentTask_() == recon_task) {
@@ -797,8 +1006,8 @@ void MainWindow::TaskCompleted(ReconTask *recon_task)
 void MainWindow::on_comboBoxProjectionIndex_currentIndexChanged(int index)
 {
     if (GetTaskCount_() == 0) return;
-    if (index < 0 || GetCurrentParameter_().projection.shape().empty()
-            || index >= GetCurrentParameter_().projection.shape()[0]) return;
+    const Tensor& projection = GetCurrentParameter_().data->projection;
+    if (index < 0 || projection.shape().empty() || index >= projection.shape()[0]) return;
     UpdateProjection_(index);
     DrawProjectionLine_();
     ui->horizontalScrollBarProjection->setValue(index);
@@ -809,8 +1018,8 @@ void MainWindow::on_comboBoxProjectionIndex_currentIndexChanged(int index)
 void MainWindow::on_comboBoxSinogramIndex_currentIndexChanged(int index)
 {
     if (GetTaskCount_() == 0) return;
-    if (index < 0 || GetCurrentParameter_().sinogram.shape().empty()
-            || index >= GetCurrentParameter_().sinogram.shape()[0]) return;
+    const Tensor& sinogram = GetCurrentParameter_().data->sinogram;
+    if (index < 0 || sinogram.shape().empty() || index >= sinogram.shape()[0]) return;
     UpdateSinogram_(index);
     DrawProjectionLine_();
     ui->horizontalScrollBarSinogram->setValue(index);
@@ -951,3 +1160,55 @@ void MainWindow::on_lineEditNumDetectors_textEdited(const QString &arg1)
     GetCurrentParameter_().num_detectors = num;
     ParamChanged_();
 }
+
+void MainWindow::on_checkBoxVolume_stateChanged(int arg1)
+{
+    bool reconstruct_volume = arg1 == Qt::Checked;
+    ui->lineEditSliceBegin->setEnabled(reconstruct_volume);
+    ui->lineEditSliceEnd->setEnabled(reconstruct_volume);
+    GetCurrentParameter_().reconstruct_volume = reconstruct_volume;
+    ParamChanged_();
+}
+
+void MainWindow::on_lineEditSliceBegin_editingFinished()
+{
+    bool ok = false;
+    int slice_begin = ui->lineEditSliceBegin->text().toUInt(&ok);
+    if (!ok) {
+        ShowMessageBox("Non-negative first slice is required.");
+        ui->lineEditSliceBegin->setFocus();
+        return;
+    }
+    GetCurrentParameter_().slice_begin = slice_begin;
+    ParamChanged_();
+}
+
+void MainWindow::on_lineEditSliceEnd_editingFinished()
+{
+    // The last slice is inclusive in the UI; leaving it empty selects all.
+    QString text = ui->lineEditSliceEnd->text().trimmed();
+    int slice_end = -1;
+    if (!text.isEmpty()) {
+        bool ok = false;
+        slice_end = text.toUInt(&ok) + 1;
+        if (!ok) {
+            ShowMessageBox("Non-negative last slice is required.");
+            ui->lineEditSliceEnd->setFocus();
+            return;
+        }
+    }
+    GetCurrentParameter_().slice_end = slice_end;
+    ParamChanged_();
+}
+
+void MainWindow::on_actionMax_Concurrent_Tasks_triggered()
+{
+    bool ok = false;
+    int max_concurrent_tasks = QInputDialog::getInt(
+                this, tr("Max Concurrent Tasks"),
+                tr("Number of tasks running at the same time:"),
+                scheduler_->GetMaxConcurrentTasks(), 1, GetHardwareThreadCount(), 1, &ok);
+    if (!ok) return;
+    scheduler_->SetMaxConcurrentTasks(max_concurrent_tasks);
+    ui->statusbar->showMessage(tr("Each task may use %1 thread(s).").arg(scheduler_->GetThreadBudget()));
+}
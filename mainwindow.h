@@ -6,13 +6,14 @@
 #include <QListWidgetItem>
 #include <QDir>
 #include <QProgressBar>
-#include <QTimer>
 #include <QMessageBox>
 
 #include <ui_mainwindow.h>
 #include <recontask.h>
 #include "recontaskparameter.h"
 #include "resultdialog.h"
+#include "volumeviewer.h"
+#include "reconscheduler.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -27,26 +28,18 @@ public:
     ~MainWindow();
 
 private slots:
-    void CheckStatus()
-    {
-        UpdateStatusBar_();
-        if (GetTaskCount_()) {
-            if (CurrentTask_().GetStatus() == ReconTask::Status::kCompleted) {
-                ui->pushButtonShowResult->setEnabled(true);
-            }
-            if (CurrentTask_().GetStatus() == ReconTask::Status::kRunning) {
-                ui->pushButtonRun->setEnabled(false);
-            } else {
-                ui->pushButtonRun->setEnabled(true);
-            }
-        }
-    }
     void TaskCompleted(ReconTask *recon_task);
 
+    void TaskProgressChanged(ReconTask *recon_task);
+
+    void TaskStateChanged(ReconTask *recon_task);
+
     void on_actionExit_triggered();
 
     void on_actionNew_Task_triggered();
 
+    void on_actionDuplicate_Task_triggered();
+
     void on_listWidgetTask_currentRowChanged(int currentRow);
 
     void on_checkBoxScatterMap_stateChanged(int arg1);
@@ -91,6 +84,10 @@ private slots:
 
     void on_checkBoxRestore_stateChanged(int arg1);
 
+    void on_comboBoxModelPrecision_currentIndexChanged(int index);
+
+    void on_comboBoxRestoredOutput_currentIndexChanged(int index);
+
     void on_actionRun_All_Tasks_triggered();
 
     void on_horizontalScrollBarSinogram_valueChanged(int value);
@@ -99,6 +96,8 @@ private slots:
 
     void on_pushButtonShowResult_clicked();
 
+    void on_pushButtonShowVolume_clicked();
+
     void on_comboBoxProjectionIndex_currentIndexChanged(int index);
 
     void on_comboBoxSinogramIndex_currentIndexChanged(int index);
@@ -121,6 +120,18 @@ private slots:
 
     void on_lineEditNumDetectors_textEdited(const QString &arg1);
 
+    void on_checkBoxVolume_stateChanged(int arg1);
+
+    void on_lineEditSliceBegin_editingFinished();
+
+    void on_lineEditSliceEnd_editingFinished();
+
+    void on_actionMax_Concurrent_Tasks_triggered();
+
+    void on_pushButtonPause_clicked();
+
+    void on_pushButtonCancel_clicked();
+
 private:
     void ReleaseData_();
     void UpdateParameterDisplay_();
@@ -131,6 +142,8 @@ private:
     void UpdateSinogram_(int index);
     void UpdateStatusBar_();
     void DrawProjectionLine_();
+    void UpdateTaskListItem_(int task_index);
+    void UpdateControlButtons_();
     int CurrentTaskIndex_() const;
     int GetTaskCount_() const {
         return static_cast<int>(task_array_.size());
@@ -207,6 +220,6 @@ private:
     static QString base_dir_;
     QString current_dir_;
     QProgressBar *progress_bar_;
-    QTimer *timer_;
+    ReconScheduler *scheduler_;
 };
 #endif // MAINWINDOW_H
@@ -0,0 +1,186 @@
+#include "ortsessioncache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace {
+
+#ifdef WIN32
+std::wstring ToOrtPath(const QString& path) { return path.toStdWString(); }
+#else
+std::string ToOrtPath(const QString& path) { return path.toStdString(); }
+#endif
+
+GraphOptimizationLevel ToGraphOptimizationLevel(int level)
+{
+    switch (level) {
+    case 0: return ORT_DISABLE_ALL;
+    case 1: return ORT_ENABLE_BASIC;
+    case 2: return ORT_ENABLE_EXTENDED;
+    default: return ORT_ENABLE_ALL;
+    }
+}
+
+} // namespace
+
+SessionConfig SessionConfig::Load(const QString &path)
+{
+    SessionConfig config;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return config;
+    const QJsonObject object = QJsonDocument::fromJson(file.readAll()).object();
+    config.intra_op_num_threads = object.value("intra_op_num_threads").toInt(config.intra_op_num_threads);
+    config.inter_op_num_threads = object.value("inter_op_num_threads").toInt(config.inter_op_num_threads);
+    config.parallel_execution = object.value("parallel_execution").toBool(config.parallel_execution);
+    config.graph_optimization_level = object.value("graph_optimization_level").toInt(config.graph_optimization_level);
+    config.enable_cpu_mem_arena = object.value("enable_cpu_mem_arena").toBool(config.enable_cpu_mem_arena);
+    config.enable_mem_pattern = object.value("enable_mem_pattern").toBool(config.enable_mem_pattern);
+    config.cache_optimized_model = object.value("cache_optimized_model").toBool(config.cache_optimized_model);
+    return config;
+}
+
+std::string SessionConfig::ToKey() const
+{
+    return "intra=" + std::to_string(intra_op_num_threads)
+            + ",inter=" + std::to_string(inter_op_num_threads)
+            + ",parallel=" + std::to_string(parallel_execution)
+            + ",opt=" + std::to_string(graph_optimization_level)
+            + ",arena=" + std::to_string(enable_cpu_mem_arena)
+            + ",pattern=" + std::to_string(enable_mem_pattern);
+}
+
+Ort::SessionOptions SessionConfig::CreateSessionOptions(bool optimized) const
+{
+    Ort::SessionOptions options;
+    if (intra_op_num_threads > 0) options.SetIntraOpNumThreads(intra_op_num_threads);
+    if (inter_op_num_threads > 0) options.SetInterOpNumThreads(inter_op_num_threads);
+    options.SetExecutionMode(parallel_execution ? ExecutionMode::ORT_PARALLEL
+                                                : ExecutionMode::ORT_SEQUENTIAL);
+    options.SetGraphOptimizationLevel(optimized ? ORT_DISABLE_ALL
+                                                : ToGraphOptimizationLevel(graph_optimization_level));
+    if (enable_cpu_mem_arena) {
+        options.EnableCpuMemArena();
+    } else {
+        options.DisableCpuMemArena();
+    }
+    if (enable_mem_pattern) {
+        options.EnableMemPattern();
+    } else {
+        options.DisableMemPattern();
+    }
+    return options;
+}
+
+OrtSessionCache::OrtSessionCache(const QString &optimized_model_dir):
+    env_(ORT_LOGGING_LEVEL_WARNING, "Default"),
+    optimized_model_dir_(optimized_model_dir)
+{
+}
+
+std::shared_ptr<Ort::Session> OrtSessionCache::Acquire(const QString &model_path,
+                                                       const SessionConfig &config)
+{
+    QFileInfo info(model_path);
+    const QString path = info.absoluteFilePath();
+    // A model rewritten in place gets a new key.
+    const std::string config_key = config.ToKey();
+    const std::string key = path.toStdString() + "|"
+            + std::to_string(info.lastModified().toMSecsSinceEpoch()) + "|" + config_key;
+
+    std::promise<std::shared_ptr<Ort::Session> > promise;
+    SessionFuture session;
+    bool load = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(path);
+        if (it != sessions_.end() && it->second.key == key) {
+            session = it->second.session;
+        } else {
+            // Replaces the session of the file built for other options.
+            session = promise.get_future().share();
+            sessions_[path] = Entry{key, config_key, session};
+            load = true;
+        }
+    }
+    // Other callers asking for the same session wait for the one loading it.
+    if (!load) return session.get();
+    try {
+        promise.set_value(Load_(model_path, key, config));
+    } catch (...) {
+        // A failed load is not cached, so that a fixed model is picked up.
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = sessions_.find(path);
+            if (it != sessions_.end() && it->second.key == key) sessions_.erase(it);
+        }
+        promise.set_exception(std::current_exception());
+    }
+    return session.get();
+}
+
+void OrtSessionCache::SetDefaultConfig(const SessionConfig &config)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::string old_key = default_config_.ToKey();
+    default_config_ = config;
+    if (old_key == config.ToKey()) return;
+    for (auto it = sessions_.begin(); it != sessions_.end();) {
+        if (it->second.config_key == old_key) {
+            it = sessions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::shared_ptr<Ort::Session> OrtSessionCache::Load_(const QString &model_path, const std::string &key,
+                                                     const SessionConfig &config)
+{
+    qDebug() << "Building model (Model path: " << model_path << ")..." << endl;
+    QElapsedTimer timer;
+    timer.start();
+    if (!config.cache_optimized_model || optimized_model_dir_.isEmpty()) {
+        auto session = std::make_shared<Ort::Session>(env_, ToOrtPath(model_path).c_str(),
+                                                      config.CreateSessionOptions());
+        qDebug() << "Model built in " << timer.elapsed() << " (ms)." << endl;
+        return session;
+    }
+
+    // The optimized graph depends on the runtime that produced it as well.
+    const std::string cache_key = key + "|" + OrtGetApiBase()->GetVersionString();
+    const QString optimized_path = QDir(optimized_model_dir_).filePath(
+                QCryptographicHash::hash(QByteArray::fromStdString(cache_key),
+                                         QCryptographicHash::Sha1).toHex() + ".onnx");
+    if (QFileInfo::exists(optimized_path)) {
+        try {
+            auto session = std::make_shared<Ort::Session>(env_, ToOrtPath(optimized_path).c_str(),
+                                                          config.CreateSessionOptions(true));
+            qDebug() << "Optimized model loaded in " << timer.elapsed() << " (ms)." << endl;
+            return session;
+        } catch (const Ort::Exception& e) {
+            qDebug() << "Discarding optimized model " << optimized_path << ": " << e.what() << endl;
+            QFile::remove(optimized_path);
+        }
+    }
+
+    // Written under a temporary name, so that an interrupted load does not
+    // leave a truncated model behind.
+    QDir().mkpath(optimized_model_dir_);
+    const QString temp_path = optimized_path + ".tmp";
+    Ort::SessionOptions options = config.CreateSessionOptions();
+    options.SetOptimizedModelFilePath(ToOrtPath(temp_path).c_str());
+    auto session = std::make_shared<Ort::Session>(env_, ToOrtPath(model_path).c_str(), options);
+    QFile::remove(optimized_path);
+    if (!QFile::rename(temp_path, optimized_path)) {
+        QFile::remove(temp_path);
+    }
+    qDebug() << "Model built and optimized model saved in " << timer.elapsed() << " (ms)." << endl;
+    return session;
+}
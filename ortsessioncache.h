@@ -0,0 +1,92 @@
+#ifndef ORTSESSIONCACHE_H
+#define ORTSESSIONCACHE_H
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <QString>
+
+#include <onnxruntime_cxx_api.h>
+
+// Options a restoration session is built with. Sessions built with
+// different options are cached apart.
+struct SessionConfig {
+    // Threads used within an operator. 0 leaves the choice to the
+    // application, see SpectEngine::SetDefaultRestorationThreads, and to the
+    // ONNX Runtime default of all cores where it makes none.
+    int intra_op_num_threads = 0;
+    // Threads running independent operators in parallel execution mode.
+    int inter_op_num_threads = 1;
+    bool parallel_execution = false;
+    // 0 disables graph optimizations, 1 basic, 2 extended, 3 all.
+    int graph_optimization_level = 3;
+    bool enable_cpu_mem_arena = true;
+    bool enable_mem_pattern = true;
+    // Keep the optimized graph on disk and load it on later startups.
+    bool cache_optimized_model = true;
+
+    // Reads the options from a JSON object whose keys are the member names.
+    // Missing keys keep their defaults, as does everything if the file
+    // cannot be read.
+    static SessionConfig Load(const QString& path);
+    std::string ToKey() const;
+    // `optimized` asks for the options of a model that has already been
+    // optimized, whose graph is taken as it is.
+    Ort::SessionOptions CreateSessionOptions(bool optimized = false) const;
+};
+
+// Process-wide cache of ONNX Runtime sessions, one per model file. All
+// sessions share one Ort::Env and stay loaded, so that only the first run of
+// a model pays for loading and optimizing the graph. A session asked for
+// with other options, or of a model rewritten in place, replaces the one of
+// the same file; holders of the old one keep it until they let go.
+// Ort::Session::Run may be called concurrently, so a session is shared by
+// every worker that needs it. Models are loaded outside the lock, so that
+// loading one does not hold up lookups of others.
+class OrtSessionCache
+{
+public:
+    // Optimized models are kept in `optimized_model_dir`; none are kept if
+    // it is empty.
+    explicit OrtSessionCache(const QString& optimized_model_dir = QString());
+
+    // Returns the session for `model_path`, loading it on a miss. Throws
+    // Ort::Exception if the model cannot be loaded.
+    std::shared_ptr<Ort::Session> Acquire(const QString& model_path,
+                                          const SessionConfig& config);
+    // The same with the default options.
+    std::shared_ptr<Ort::Session> Acquire(const QString& model_path) {
+        return Acquire(model_path, GetDefaultConfig());
+    }
+    // Sessions built with the previous default options are dropped.
+    void SetDefaultConfig(const SessionConfig& config);
+    SessionConfig GetDefaultConfig() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return default_config_;
+    }
+
+private:
+    std::shared_ptr<Ort::Session> Load_(const QString& model_path, const std::string& key,
+                                        const SessionConfig& config);
+
+    typedef std::shared_future<std::shared_ptr<Ort::Session> > SessionFuture;
+    struct Entry {
+        // Modification time and options the session was built for.
+        std::string key;
+        std::string config_key;
+        // Ready once the session is loaded; waited for by concurrent lookups.
+        SessionFuture session;
+    };
+
+    Ort::Env env_;
+    QString optimized_model_dir_;
+    mutable std::mutex mutex_;
+    SessionConfig default_config_;
+    // Keyed by absolute model path, which includes the precision.
+    std::map<QString, Entry> sessions_;
+};
+
+#endif // ORTSESSIONCACHE_H
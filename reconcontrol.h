@@ -0,0 +1,52 @@
+#ifndef RECONCONTROL_H
+#define RECONCONTROL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+// Cancellation token and pause switch shared between the GUI and a running
+// reconstruction. The reconstruction polls it between units of work.
+class ReconControl
+{
+public:
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = false;
+        paused_ = false;
+    }
+    void Cancel() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+        cv_.notify_all();
+    }
+    bool IsCancelled() const {
+        return cancelled_;
+    }
+    void Pause() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        paused_ = true;
+    }
+    void Resume() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        paused_ = false;
+        cv_.notify_all();
+    }
+    bool IsPaused() const {
+        return paused_;
+    }
+    // Blocks while paused. Returns false if the run has been cancelled.
+    bool WaitWhilePaused() {
+        if (!paused_) return !cancelled_;
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !paused_ || cancelled_; });
+        return !cancelled_;
+    }
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> cancelled_{false};
+    std::atomic<bool> paused_{false};
+};
+
+#endif // RECONCONTROL_H
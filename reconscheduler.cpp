@@ -0,0 +1,87 @@
+#include "reconscheduler.h"
+
+#include <algorithm>
+
+#include "spectengine.h"
+#include "threadbudget.h"
+
+ReconScheduler::ReconScheduler(QObject *parent):
+    QObject(parent)
+{
+    SpectEngine::Instance().SetDefaultRestorationThreads(GetThreadBudget());
+}
+
+void ReconScheduler::SetMaxConcurrentTasks(int max_concurrent_tasks)
+{
+    max_concurrent_tasks_ = std::max(1, max_concurrent_tasks);
+    // Restoration runs within the budget of the task it serves.
+    SpectEngine::Instance().SetDefaultRestorationThreads(GetThreadBudget());
+    Dispatch_();
+}
+
+int ReconScheduler::GetThreadBudget() const
+{
+    return std::max(1, GetHardwareThreadCount() / max_concurrent_tasks_);
+}
+
+void ReconScheduler::Enqueue(ReconTask *task, int priority)
+{
+    if (task == nullptr) return;
+    if (task->IsActive()) return;
+    connect(task, &ReconTask::TaskCompleted, this, &ReconScheduler::OnTaskCompleted,
+            Qt::UniqueConnection);
+    queue_.push_back(Entry{task, priority, next_sequence_++});
+    task->SetQueued(true);
+    emit(TaskStateChanged(task));
+    Dispatch_();
+}
+
+void ReconScheduler::Dequeue(ReconTask *task)
+{
+    auto it = std::find_if(queue_.begin(), queue_.end(),
+                           [task](const Entry& entry) { return entry.task == task; });
+    if (it == queue_.end()) return;
+    queue_.erase(it);
+    task->SetQueued(false);
+    emit(TaskStateChanged(task));
+}
+
+void ReconScheduler::Cancel(ReconTask *task)
+{
+    if (task == nullptr) return;
+    if (task->GetStatus() == ReconTask::Status::kQueued) {
+        Dequeue(task);
+    } else {
+        // The slot is released once the thread finishes.
+        task->Cancel();
+        emit(TaskStateChanged(task));
+    }
+}
+
+void ReconScheduler::OnTaskCompleted(ReconTask *task)
+{
+    auto it = std::find(running_.begin(), running_.end(), task);
+    if (it != running_.end()) running_.erase(it);
+    emit(TaskStateChanged(task));
+    Dispatch_();
+}
+
+void ReconScheduler::Dispatch_()
+{
+    while (static_cast<int>(running_.size()) < max_concurrent_tasks_ && !queue_.empty()) {
+        auto next = std::min_element(queue_.begin(), queue_.end(),
+                                     [](const Entry& a, const Entry& b) {
+            if (a.priority != b.priority) return a.priority > b.priority;
+            return a.sequence < b.sequence;
+        });
+        ReconTask *task = next->task;
+        queue_.erase(next);
+        task->SetQueued(false);
+        task->SetThreadBudget(GetThreadBudget());
+        task->Start();
+        if (task->GetStatus() == ReconTask::Status::kRunning) {
+            running_.push_back(task);
+        }
+        emit(TaskStateChanged(task));
+    }
+}
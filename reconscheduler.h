@@ -0,0 +1,60 @@
+#ifndef RECONSCHEDULER_H
+#define RECONSCHEDULER_H
+
+#include <vector>
+
+#include <QObject>
+
+#include "recontask.h"
+
+// Runs reconstruction tasks with a bounded number of them at a time. Waiting
+// tasks are started by descending priority, and in submission order among
+// equal priorities. Every started task gets an equal share of the cores as
+// the OpenMP thread budget of the library.
+class ReconScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ReconScheduler(QObject *parent);
+
+    void SetMaxConcurrentTasks(int max_concurrent_tasks);
+    int GetMaxConcurrentTasks() const {
+        return max_concurrent_tasks_;
+    }
+    // Threads given to each running task.
+    int GetThreadBudget() const;
+    // Queues `task` unless it is already queued or running.
+    void Enqueue(ReconTask *task, int priority = 0);
+    // Drops `task` from the queue if it has not been started yet.
+    void Dequeue(ReconTask *task);
+    // Dequeues `task` if it is waiting, or stops it if it is running.
+    void Cancel(ReconTask *task);
+    int GetNumQueuedTasks() const {
+        return static_cast<int>(queue_.size());
+    }
+    int GetNumRunningTasks() const {
+        return static_cast<int>(running_.size());
+    }
+
+signals:
+    // Emitted whenever a task is queued, started or finished.
+    void TaskStateChanged(ReconTask *task);
+
+private slots:
+    void OnTaskCompleted(ReconTask *task);
+
+private:
+    struct Entry {
+        ReconTask *task;
+        int priority;
+        unsigned long long sequence;
+    };
+    void Dispatch_();
+
+    int max_concurrent_tasks_ = 1;
+    unsigned long long next_sequence_ = 0;
+    std::vector<Entry> queue_;
+    std::vector<ReconTask *> running_;
+};
+
+#endif // RECONSCHEDULER_H
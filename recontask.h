@@ -1,32 +1,48 @@
 #ifndef RECONTASK_H
 #define RECONTASK_H
 
+#include <QFile>
 #include <QObject>
 #include <QPixmap>
+#include <QVector>
 
 #include "utils.h"
 #include "recontaskparameter.h"
 #include "reconthread.h"
+#include "spectengine.h"
 
 class ReconTask: public QObject
 {
     Q_OBJECT
 public:
+    // The worker is created on the first run, so a new task costs nothing.
     ReconTask(QObject *parent):
         QObject(parent),
         parameter_(),
-        thread_(new ReconThread(this))
+        thread_(nullptr)
     {
-        connect(thread_, SIGNAL(finished()), this, SLOT(OnThreadFinished()));
     }
     enum class Status {
         kInit, // Sinograms and projections have not been loaded yet.
         kLoaded, // Sinograms and projections have been loaded successfully.
+        kQueued, // Task is waiting for the scheduler to start it.
         kRunning, // Task is running.
+        kPaused, // Task is running but holds before its next slice.
         kCompleted, // Reconstruction completed successfully.
+        kCancelled, // Reconstruction stopped by the user.
         kFailedToReconstruct, // Error occurred in reconstruction.
     };
 
+    // Takes the settings and loaded arrays of `other` but none of its
+    // results, e.g. to start a parameter sweep. Arrays and pixmaps are
+    // shared rather than copied.
+    void CopyInputFrom(const ReconTask& other) {
+        parameter_ = other.parameter_;
+        parameter_.result = std::make_shared<ReconTaskResult>();
+        pixmap_sinogram_array_ = other.pixmap_sinogram_array_;
+        pixmap_projection_array_ = other.pixmap_projection_array_;
+        restored_sinogram_ = other.restored_sinogram_;
+    }
     const ReconTaskParameter& GetParameter() const {
         return parameter_;
     }
@@ -34,42 +50,115 @@ public:
         return parameter_;
     }
     void Start() {
-        if (thread_ && !thread_->isRunning()) {
+        CreateThread_();
+        if (!thread_->isRunning()) {
+            result_image_array_.clear();
             pixmap_result_array_.clear();
+            pixmap_sinogram_used_ = QPixmap();
             result_iter_index_array_.clear();
 
-            thread_->SetParameter(parameter_);
-            thread_->start();
+            thread_->SetThreadBudget(thread_budget_);
+            thread_->SetResumeFromCheckpoint(resume_from_checkpoint_);
+            thread_->SetRestoredSinogram(restored_sinogram_);
+            resume_from_checkpoint_ = false;
+            failed_to_start_ = thread_->SetParameter(parameter_) != 0;
+            if (!failed_to_start_) thread_->start();
         }
     }
     Status GetStatus() const {
-        if (thread_ == nullptr) return Status::kFailedToReconstruct;
-        if (thread_->isFinished()) {
+        if (failed_to_start_) return Status::kFailedToReconstruct;
+        if (queued_) return Status::kQueued;
+        if (thread_ && thread_->isFinished()) {
             if (thread_->GetProgress() == 100) {
                 return Status::kCompleted;
+            } else if (thread_->IsCancelled()) {
+                return Status::kCancelled;
             } else {
                 return Status::kFailedToReconstruct;
             }
-        } else if (thread_->isRunning()){
-           return Status::kRunning;
+        } else if (thread_ && thread_->isRunning()){
+           return thread_->IsPaused() ? Status::kPaused : Status::kRunning;
         } else if (pixmap_sinogram_array_.size() > 0) {
             return Status::kLoaded;
         } else {
             return Status::kInit;
         }
     }
+    // Queued, running or paused.
+    bool IsActive() const {
+        const Status status = GetStatus();
+        return status == Status::kQueued || status == Status::kRunning
+                || status == Status::kPaused;
+    }
     int GetProgress() const {
-        return thread_->GetProgress();
+        return thread_ ? thread_->GetProgress() : 0;
+    }
+    qint64 GetMsPerIteration() const {
+        return thread_ ? thread_->GetMsPerIteration() : 0;
+    }
+    qint64 GetEtaMs() const {
+        return thread_ ? thread_->GetEtaMs() : -1;
+    }
+    void Pause() {
+        if (thread_ && thread_->isRunning()) thread_->Pause();
+    }
+    void Resume() {
+        if (thread_) thread_->Resume();
+    }
+    // Stops a running task after the slice in progress. Queued tasks are
+    // dropped by ReconScheduler::Cancel instead.
+    void Cancel() {
+        if (thread_ && thread_->isRunning()) thread_->Cancel();
+    }
+    // Whether an interrupted run of this task left a checkpoint behind.
+    bool HasCheckpoint() const {
+        return QFile::exists(parameter_.GetCheckpointPath());
+    }
+    // Makes the next run resume from the checkpoint if it still matches.
+    void SetResumeFromCheckpoint(bool resume) {
+        resume_from_checkpoint_ = resume;
+    }
+    // Whether there is something to display, including the partial results
+    // of a cancelled task.
+    bool HasResult() const {
+        return result_array_ && !result_array_->empty();
+    }
+    // Set by ReconScheduler while the task waits for a free slot.
+    void SetQueued(bool queued) {
+        queued_ = queued;
+        if (queued) failed_to_start_ = false;
+    }
+    // The number of threads the next run may use.
+    void SetThreadBudget(int num_threads) {
+        thread_budget_ = num_threads;
     }
     const QString& GetTaskName() const {
         return parameter_.task_name;
     }
     const QPixmap& GetPixmapResult(int index) const {
-        if (GetStatus() != Status::kCompleted) {
+        if (!HasResult()) {
             std::cerr << "Trying to get result pixmap from a non-completed reconstruction task!\n";
             exit(-1);
         }
-        return pixmap_result_array_[index];
+        return GetPixmapResultArray()[index];
+    }
+    // Pixmaps are implicitly shared, so the returned array may be copied freely.
+    const QVector<QPixmap>& GetPixmapResultArray() const {
+        if (pixmap_result_array_.size() != result_image_array_.size()) {
+            pixmap_result_array_.clear();
+            pixmap_result_array_.reserve(result_image_array_.size());
+            for (const auto& image: result_image_array_) {
+                pixmap_result_array_.push_back(QPixmap::fromImage(image));
+            }
+        }
+        return pixmap_result_array_;
+    }
+    const QPixmap& GetPixmapSinogramUsed() const {
+        const Tensor& sinogram_used = parameter_.result->sinogram_used_to_reconstruct;
+        if (pixmap_sinogram_used_.isNull() && sinogram_used.shape().size() == 2) {
+            pixmap_sinogram_used_ = GetPixmapFromTensor2D(sinogram_used);
+        }
+        return pixmap_sinogram_used_;
     }
     const std::vector<int> GetResultIterIndexArray() const {
         return result_iter_index_array_;
@@ -95,37 +184,71 @@ public:
         return GetPixmapProjection(parameter_.index_projection);
     }
     bool GetLoadedFlag() {
-        return parameter_.sinogram.shape().size() > 0;
+        return parameter_.data->sinogram.shape().size() > 0;
     }
-    const std::vector<Tensor>& GetResultArray() const {
+    const SharedTensorArray& GetResultArray() const {
         return result_array_;
     }
-    std::vector<Tensor>& GetResultArray() {
-        return result_array_;
+    // The reconstructed volume, shaped (num_slices, height, width). A
+    // single-slice run yields its final result as a one-slice volume.
+    Tensor GetResultVolume() const {
+        if (result_volume_.shape().size() == 3) return result_volume_;
+        if (!result_array_ || result_array_->empty()) return Tensor();
+        const Tensor& final_result = result_array_->front();
+        if (final_result.shape().size() != 2) return Tensor();
+        return final_result.Reshape({1, final_result.shape()[0], final_result.shape()[1]});
     }
 protected:
 signals:
     void TaskCompleted(ReconTask *recon_task);
+    void ProgressChanged(ReconTask *recon_task);
 
 private slots:
+    void OnThreadProgress()
+    {
+        emit(ProgressChanged(this));
+    }
     void OnThreadFinished()
     {
         if (thread_ == nullptr) return;
-        parameter_.reconstructed_tomographs = thread_->GetResultArray();
-        result_iter_index_array_ = thread_->GetResultIterIndexArray();
+        // Every holder shares the thread's result buffer; nothing is copied.
         result_array_ = thread_->GetResultArray();
-        for (auto& tensor: result_array_) {
-            pixmap_result_array_.push_back(GetPixmapFromTensor2D(tensor));
-        }
+        result_image_array_ = thread_->GetResultImageArray();
+        result_volume_ = thread_->GetResultVolume();
+        auto result = std::make_shared<ReconTaskResult>();
+        result->reconstructed_tomographs = result_array_;
+        result->sinogram_used_to_reconstruct = thread_->GetSinogramUsedToReconstruct();
+        parameter_.result = result;
+        result_iter_index_array_ = thread_->GetResultIterIndexArray();
+        // A run cancelled before finishing any slice leaves the old state.
+        if (thread_->GetRestoredSinogram()) restored_sinogram_ = thread_->GetRestoredSinogram();
         emit(TaskCompleted(this));
     }
 private:
+    void CreateThread_() {
+        if (thread_) return;
+        thread_ = SpectEngine::Instance().CreateWorker(this);
+        connect(thread_, SIGNAL(finished()), this, SLOT(OnThreadFinished()));
+        // Queued to the thread of the task, so receivers run on the GUI thread.
+        connect(thread_, &ReconThread::Progress, this, &ReconTask::OnThreadProgress);
+    }
+
     ReconTaskParameter parameter_;
     ReconThread *thread_;
+    int thread_budget_ = 0;
+    bool queued_ = false;
+    bool failed_to_start_ = false;
+    bool resume_from_checkpoint_ = false;
+    // Restored slices cached for the next runs of the task.
+    ReconThread::SharedRestoredSinogram restored_sinogram_;
 
     // For displaying
-    std::vector<Tensor> result_array_;
-    std::vector<QPixmap> pixmap_result_array_;
+    SharedTensorArray result_array_;
+    QVector<QImage> result_image_array_;
+    Tensor result_volume_;
+    // Converted from result_image_array_ on first use in the GUI thread.
+    mutable QVector<QPixmap> pixmap_result_array_;
+    mutable QPixmap pixmap_sinogram_used_;
     std::vector<int> result_iter_index_array_;
 
     std::vector<QPixmap> pixmap_sinogram_array_;
@@ -1,9 +1,27 @@
 #include "recontaskparameter.h"
 
+#include <algorithm>
+
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDebug>
 #include <QDir>
 
 #include "error_code.h"
+#include "global_defs.h"
+
+const QByteArray &ReconTaskData::GetSinogramDigest() const
+{
+    std::call_once(digest_flag_, [this]() {
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        for (int dim: sinogram.shape()) hash.addData(QByteArray::number(dim) + ",");
+        const std::vector<double>& data = sinogram.data();
+        hash.addData(reinterpret_cast<const char *>(data.data()),
+                     static_cast<int>(data.size() * sizeof(double)));
+        sinogram_digest_ = hash.result();
+    });
+    return sinogram_digest_;
+}
 
 recontaskparameter_pb::ReconTaskParameterPB_IteratorType
 ReconTaskParameter::IteratorTypeStrToPB(const QString &iterator)
@@ -110,8 +128,16 @@ ReconTaskParameter::ToProtobuf() const
     param_ptr->set_num_input_images(num_input_images);
     param_ptr->set_index_sinogram(index_sinogram);
     param_ptr->set_index_projection(index_projection);
+    param_ptr->set_reconstruct_volume(reconstruct_volume);
+    param_ptr->set_slice_begin(slice_begin);
+    param_ptr->set_slice_end(slice_end);
+    param_ptr->set_snapshot_interval(snapshot_interval);
+    param_ptr->set_model_precision(model_precision);
+    param_ptr->set_restored_output(restored_output);
 
     // Serialize sinogram data and projection data.
+    const Tensor& sinogram = data->sinogram;
+    const Tensor& projection = data->projection;
     if (sinogram.shape().size() > 0) {
         if (sinogram.shape().size() != 3) {
             std::cerr << "Invalid size of sinogram shape: " << sinogram.shape().size() << std::endl;
@@ -122,30 +148,34 @@ ReconTaskParameter::ToProtobuf() const
             exit(-1);
         }
         param_ptr->set_loaded(true);
-        for (size_t i = 0; i < sinogram.data().size(); ++i) {
-            param_ptr->add_sinogram_data(sinogram.data()[i]);
+        const std::vector<double>& sinogram_data = sinogram.data();
+        for (size_t i = 0; i < sinogram_data.size(); ++i) {
+            param_ptr->add_sinogram_data(sinogram_data[i]);
         }
         param_ptr->set_num_slices(sinogram.shape()[0]);
         param_ptr->set_num_angles(sinogram.shape()[1]);
         param_ptr->set_num_detectors(sinogram.shape()[2]);
-        param_ptr->set_num_results(reconstructed_tomographs.size());
-        if (reconstructed_tomographs.size() > 0) {
-            if (reconstructed_tomographs[0].shape()[0] != resolution) {
+        const SharedTensorArray& reconstructed_tomographs = result->reconstructed_tomographs;
+        const size_t num_results = reconstructed_tomographs ? reconstructed_tomographs->size() : 0;
+        param_ptr->set_num_results(num_results);
+        if (num_results > 0) {
+            const auto& results = *reconstructed_tomographs;
+            if (results[0].shape()[0] != resolution) {
                 std::cerr << "The shape of result is inconsistent to resolution " << resolution;
                 exit(-1);
             }
-            param_ptr->set_num_results(reconstructed_tomographs.size());
+            param_ptr->set_num_results(num_results);
             param_ptr->set_done(true);
-            param_ptr->set_resolution(reconstructed_tomographs[0].shape()[0]);
+            param_ptr->set_resolution(results[0].shape()[0]);
+            for (size_t i = 0; i < num_results; ++i) {
+                for (size_t j = 0; j < results[i].data().size(); ++j) {
+                    param_ptr->add_reconstructed_tomographs_data(results[i].data()[j]);
+                }
+            }
         } else {
             param_ptr->set_done(false);
             param_ptr->set_resolution(0);
         }
-        for (size_t i = 0; i < reconstructed_tomographs.size(); ++i) {
-            for (size_t j = 0; j < reconstructed_tomographs[i].data().size(); ++j) {
-                param_ptr->add_reconstructed_tomographs_data(reconstructed_tomographs[i].data()[j]);
-            }
-        }
     } else {
         param_ptr->set_loaded(false);
         param_ptr->set_done(false);
@@ -181,6 +211,12 @@ int ReconTaskParameter::FromProtobuf(
     path_model = QString::fromStdString(param_pb.path_model());
     index_sinogram = param_pb.index_sinogram();
     index_projection = param_pb.index_projection();
+    reconstruct_volume = param_pb.reconstruct_volume();
+    slice_begin = param_pb.slice_begin();
+    slice_end = param_pb.slice_end();
+    snapshot_interval = param_pb.snapshot_interval();
+    model_precision = param_pb.model_precision();
+    restored_output = param_pb.restored_output();
 
     iterator_type = IteratorTypePBToStr(param_pb.iterator());
     if (param_pb.has_path_scatter_map()) {
@@ -201,11 +237,15 @@ int ReconTaskParameter::FromProtobuf(
             sino.push_back(param_pb.sinogram_data(i));
         }
         std::vector<int> shape{param_pb.num_slices(), param_pb.num_angles(), param_pb.num_detectors()};
-        sinogram.Set(shape, std::move(sino));
-        projection = sinogram.Permute({1, 0, 2});
+        auto data = std::make_shared<ReconTaskData>();
+        data->sinogram.Set(shape, std::move(sino));
+        data->projection = data->sinogram.Permute({1, 0, 2});
+        this->data = data;
     }
 
+    auto result = std::make_shared<ReconTaskResult>(*this->result);
     if (param_pb.done()) {
+        auto results = std::make_shared<std::vector<Tensor>>();
         for (int i = 0; i < param_pb.num_results(); ++i) {
             std::vector<double> temp;
             const int offset = i * param_pb.resolution() * param_pb.resolution();
@@ -213,9 +253,13 @@ int ReconTaskParameter::FromProtobuf(
                 temp.push_back(param_pb.reconstructed_tomographs_data(offset + j));
             }
             std::vector<int> shape(2, param_pb.resolution());
-            reconstructed_tomographs.push_back(Tensor(shape, std::move(temp)));
+            results->push_back(Tensor(shape, std::move(temp)));
         }
+        result->reconstructed_tomographs = results;
+    } else {
+        result->reconstructed_tomographs.reset();
     }
+    this->result = result;
     return 0;
 }
 
@@ -248,3 +292,69 @@ int ReconTaskParameter::FromProtobufFilePath(const QString &path)
     FromProtobuf(param_pb);
     return 0;
 }
+
+QByteArray ReconTaskParameter::GetStateFingerprint() const
+{
+    QByteArray header;
+    QDataStream stream(&header, QIODevice::WriteOnly);
+    stream << path_sysmat << use_scatter_map << path_scatter_map << coeff_scatter
+           << iterator_type << lambda << gamma << num_dual_iters
+           << num_detectors << num_angles << use_nn << GetModelPath() << filter_type;
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(header);
+    hash.addData(data->GetSinogramDigest());
+    return hash.result();
+}
+
+QString ReconTaskParameter::GetResolvedOutputDir() const
+{
+    QString output_dir = this->output_dir.trimmed();
+    if (QDir(output_dir).isRelative()) {
+        output_dir = QDir(QDir(kBaseDir).filePath(output_dir)).filePath(task_name);
+    }
+    return output_dir;
+}
+
+void ReconTaskParameter::GetSliceRange(int *slice_begin, int *slice_end) const
+{
+    const Tensor& sinogram = data->sinogram;
+    const int num_slices = sinogram.shape().size() == 3 ? sinogram.shape()[0] : this->num_slices;
+    *slice_begin = index_sinogram;
+    *slice_end = index_sinogram + 1;
+    if (reconstruct_volume) {
+        const int begin = std::min(std::max(this->slice_begin, 0), num_slices);
+        const int end = this->slice_end < 0 ? num_slices : std::min(this->slice_end, num_slices);
+        if (end > begin) {
+            *slice_begin = begin;
+            *slice_end = end;
+        }
+    }
+}
+
+QString ReconTaskParameter::GetCheckpointPath() const
+{
+    return QDir(GetResolvedOutputDir()).filePath(task_name + ".ckpt");
+}
+
+QString ReconTaskParameter::GetModelPath() const
+{
+    return GetModelPath(path_model, model_precision);
+}
+
+QString ReconTaskParameter::GetModelPath(const QString &path_model, ModelPrecision precision)
+{
+    QString suffix;
+    switch (precision) {
+    case ModelPrecision::ReconTaskParameterPB_ModelPrecision_MODEL_FP16:
+        suffix = ".fp16";
+        break;
+    case ModelPrecision::ReconTaskParameterPB_ModelPrecision_MODEL_INT8:
+        suffix = ".int8";
+        break;
+    default:
+        return path_model;
+    }
+    QString path = path_model;
+    if (path.endsWith(".onnx")) path.chop(5);
+    return path + suffix + ".onnx";
+}
@@ -1,15 +1,41 @@
 #ifndef RECONTASKPARAMETER_H
 #define RECONTASKPARAMETER_H
 
+#include <QByteArray>
 #include <QString>
 #include <QVector>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <QCoreApplication>
 
 #include "recontaskparameter.pb.h"
 #include "tensor.h"
 
+// The arrays a task is loaded with. They are never written once shared, so
+// copies of a task, e.g. the runs of a parameter sweep, refer to the same
+// object and anything derived from the arrays is computed once.
+struct ReconTaskData
+{
+    Tensor sinogram;
+    Tensor projection;
+
+    // SHA-1 of the shape and elements of the sinogram, computed on first use.
+    const QByteArray& GetSinogramDigest() const;
+
+private:
+    mutable std::once_flag digest_flag_;
+    mutable QByteArray sinogram_digest_;
+};
+typedef std::shared_ptr<const ReconTaskData> SharedReconTaskData;
+
+// What the last run of a task produced, replaced as a whole by the next run.
+struct ReconTaskResult
+{
+    SharedTensorArray reconstructed_tomographs;
+    Tensor sinogram_used_to_reconstruct;
+};
+typedef std::shared_ptr<const ReconTaskResult> SharedReconTaskResult;
 
 struct ReconTaskParameter
 {
@@ -28,6 +54,8 @@ struct ReconTaskParameter
     }
     typedef recontaskparameter_pb::ReconTaskParameterPB_FileDataType FileDataType;
     typedef recontaskparameter_pb::ReconTaskParameterPB_FileFormat FileFormat;
+    typedef recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision ModelPrecision;
+    typedef recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput RestoredOutput;
     // I/O parameters
     QString task_name = "untitled_task";
     QString path_sysmat;
@@ -47,6 +75,8 @@ struct ReconTaskParameter
     double coeff_scatter = 0.5;
     uint num_iters = 100;
     uint num_dual_iters = 1;
+    // Iterations between the intermediate results kept for display.
+    int snapshot_interval = 5;
 
     // The parameters below is unused for now
     // Numerical parameters
@@ -59,22 +89,35 @@ struct ReconTaskParameter
 
     // Use neural networks to perform restoration and scatter correction?
     bool use_nn = false;;
+    // The FP16 and INT8 variants of path_model sit next to it, see
+    // GetModelPath().
+    ModelPrecision model_precision = ModelPrecision::ReconTaskParameterPB_ModelPrecision_MODEL_FP32;
+    // Whether the restored slices are saved to the output directory, as raw
+    // float32 (.resf) or float64 (.resd). They are written in the background
+    // while the reconstruction runs.
+    RestoredOutput restored_output = RestoredOutput::ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT64;
 
     bool use_scatter_map = false;
 
     FileDataType file_data_type = FileDataType::ReconTaskParameterPB_FileDataType_FLOAT32;
     FileFormat file_format = FileFormat::ReconTaskParameterPB_FileFormat_RAW_PROJECTION;
 
-    std::vector<Tensor> reconstructed_tomographs;
-    Tensor projection;
-    Tensor sinogram;
-    Tensor sinogram_used_to_reconstruct;
-    int num_input_images;
+    // Bulk arrays, shared by every copy of the parameter and never null. A
+    // copy costs a few hundred bytes whatever the size of the study.
+    SharedReconTaskData data = std::make_shared<ReconTaskData>();
+    SharedReconTaskResult result = std::make_shared<ReconTaskResult>();
+    int num_input_images = 0;
 
     int index_sinogram = 0;
     int index_projection = 0;
     int resolution = 128;
 
+    // Reconstruct the slices in [slice_begin, slice_end) instead of
+    // index_sinogram only. slice_end < 0 stands for the number of slices.
+    bool reconstruct_volume = false;
+    int slice_begin = 0;
+    int slice_end = -1;
+
     QString filter_type;
 
     // Load task parameter from given protobuf object `param_pb`.
@@ -83,6 +126,26 @@ struct ReconTaskParameter
     // specified by `path`.
     int FromProtobufFilePath(const QString &path);
 
+    // The directory the outputs of the task go to. A relative output_dir is
+    // taken relative to kBaseDir and gets a subdirectory named after the task.
+    QString GetResolvedOutputDir() const;
+    // The slices a run reconstructs, [*slice_begin, *slice_end): the range
+    // of a volume reconstruction if it is not empty, index_sinogram
+    // otherwise.
+    void GetSliceRange(int *slice_begin, int *slice_end) const;
+    // Where an interrupted run leaves its checkpoint.
+    QString GetCheckpointPath() const;
+    // The model file of the chosen precision: path_model itself for FP32,
+    // otherwise the file with ".fp16" or ".int8" inserted before ".onnx", as
+    // written by tools/quantize_scascnet.py.
+    QString GetModelPath() const;
+    static QString GetModelPath(const QString& path_model, ModelPrecision precision);
+
+    // Digest of everything that determines the iterates of a run, so that a
+    // checkpoint is only resumed by a run it belongs to. The number of
+    // iterations, the snapshot interval and display settings are left out.
+    QByteArray GetStateFingerprint() const;
+
     std::shared_ptr<recontaskparameter_pb::ReconTaskParameterPB> ToProtobuf() const;
     int ToProtobufFilePath(const QString &path) const;
 
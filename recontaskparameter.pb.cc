@@ -16,95 +16,110 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace recontaskparameter_pb {
-constexpr ReconTaskParameterPB::ReconTaskParameterPB(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : sinogram_data_()
-  , restored_sinogram_data_()
-  , reconstructed_tomographs_data_()
-  , task_name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , path_sysmat_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , path_sinogdram_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , path_scatter_map_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , path_mu_map_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , output_dir_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , path_model_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , sinogram_info_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , num_iters_(0)
-  , num_dual_iters_(0)
-  , gamma_(0)
-  , lambda_(0)
-  , coeff_scatter_(0)
-  , iterator_(0)
-
-  , file_format_(0)
-
-  , num_input_images_(0)
-  , use_nn_(false)
-  , use_scatter_map_(false)
-  , done_(false)
-  , loaded_(false)
-  , index_sinogram_(0)
-  , index_projection_(0)
-  , num_detectors_(0)
-  , num_angles_(0)
-  , num_slices_(0)
-  , num_results_(0)
-  , resolution_(0)
-  , file_data_type_(1)
-{}
+PROTOBUF_CONSTEXPR ReconTaskParameterPB::ReconTaskParameterPB(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sinogram_data_)*/{}
+  , /*decltype(_impl_.restored_sinogram_data_)*/{}
+  , /*decltype(_impl_.reconstructed_tomographs_data_)*/{}
+  , /*decltype(_impl_.task_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_sysmat_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_sinogdram_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_scatter_map_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_mu_map_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_dir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_model_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sinogram_info_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_iters_)*/0
+  , /*decltype(_impl_.num_dual_iters_)*/0
+  , /*decltype(_impl_.gamma_)*/0
+  , /*decltype(_impl_.lambda_)*/0
+  , /*decltype(_impl_.coeff_scatter_)*/0
+  , /*decltype(_impl_.iterator_)*/0
+  , /*decltype(_impl_.file_format_)*/0
+  , /*decltype(_impl_.num_input_images_)*/0
+  , /*decltype(_impl_.use_nn_)*/false
+  , /*decltype(_impl_.use_scatter_map_)*/false
+  , /*decltype(_impl_.done_)*/false
+  , /*decltype(_impl_.loaded_)*/false
+  , /*decltype(_impl_.index_sinogram_)*/0
+  , /*decltype(_impl_.index_projection_)*/0
+  , /*decltype(_impl_.num_detectors_)*/0
+  , /*decltype(_impl_.num_angles_)*/0
+  , /*decltype(_impl_.num_slices_)*/0
+  , /*decltype(_impl_.num_results_)*/0
+  , /*decltype(_impl_.resolution_)*/0
+  , /*decltype(_impl_.reconstruct_volume_)*/false
+  , /*decltype(_impl_.slice_begin_)*/0
+  , /*decltype(_impl_.model_precision_)*/0
+  , /*decltype(_impl_.file_data_type_)*/1
+  , /*decltype(_impl_.slice_end_)*/-1
+  , /*decltype(_impl_.snapshot_interval_)*/5
+  , /*decltype(_impl_.restored_output_)*/2} {}
 struct ReconTaskParameterPBDefaultTypeInternal {
-  constexpr ReconTaskParameterPBDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ReconTaskParameterPBDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ReconTaskParameterPBDefaultTypeInternal() {}
   union {
     ReconTaskParameterPB _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ReconTaskParameterPBDefaultTypeInternal _ReconTaskParameterPB_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReconTaskParameterPBDefaultTypeInternal _ReconTaskParameterPB_default_instance_;
 }  // namespace recontaskparameter_pb
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_recontaskparameter_2eproto[1];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_recontaskparameter_2eproto[3];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_recontaskparameter_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_recontaskparameter_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_recontaskparameter_2eproto[5];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_recontaskparameter_2eproto = nullptr;
 
 const uint32_t TableStruct_recontaskparameter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, task_name_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, path_sysmat_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, path_sinogdram_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, path_scatter_map_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, path_mu_map_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, use_nn_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, use_scatter_map_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_iters_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_dual_iters_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, gamma_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, lambda_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, coeff_scatter_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, output_dir_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, iterator_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, file_format_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_input_images_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, file_data_type_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, index_sinogram_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, index_projection_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_detectors_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_angles_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_slices_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, num_results_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, sinogram_data_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, restored_sinogram_data_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, reconstructed_tomographs_data_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, done_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, loaded_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, path_model_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, sinogram_info_),
-  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, resolution_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.task_name_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.path_sysmat_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.path_sinogdram_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.path_scatter_map_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.path_mu_map_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.use_nn_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.use_scatter_map_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_iters_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_dual_iters_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.gamma_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.lambda_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.coeff_scatter_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.output_dir_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.iterator_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.file_format_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_input_images_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.file_data_type_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.index_sinogram_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.index_projection_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_detectors_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_angles_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_slices_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.num_results_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.sinogram_data_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.restored_sinogram_data_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.reconstructed_tomographs_data_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.done_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.loaded_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.path_model_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.sinogram_info_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.resolution_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.reconstruct_volume_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.slice_begin_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.slice_end_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.snapshot_interval_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.model_precision_),
+  PROTOBUF_FIELD_OFFSET(::recontaskparameter_pb::ReconTaskParameterPB, _impl_.restored_output_),
   0,
   1,
   2,
@@ -121,7 +136,7 @@ const uint32_t TableStruct_recontaskparameter_2eproto::offsets[] PROTOBUF_SECTIO
   13,
   14,
   15,
-  27,
+  30,
   20,
   21,
   22,
@@ -136,18 +151,24 @@ const uint32_t TableStruct_recontaskparameter_2eproto::offsets[] PROTOBUF_SECTIO
   6,
   7,
   26,
+  27,
+  28,
+  31,
+  32,
+  29,
+  33,
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 37, -1, sizeof(::recontaskparameter_pb::ReconTaskParameterPB)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 43, -1, sizeof(::recontaskparameter_pb::ReconTaskParameterPB)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recontaskparameter_pb::_ReconTaskParameterPB_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::recontaskparameter_pb::_ReconTaskParameterPB_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_recontaskparameter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\030recontaskparameter.proto\022\025recontaskpar"
-  "ameter_pb\"\304\t\n\024ReconTaskParameterPB\022\021\n\tta"
+  "ameter_pb\"\210\r\n\024ReconTaskParameterPB\022\021\n\tta"
   "sk_name\030\001 \002(\t\022\023\n\013path_sysmat\030\002 \002(\t\022\026\n\016pa"
   "th_sinogdram\030\003 \002(\t\022\030\n\020path_scatter_map\030\004"
   " \001(\t\022\023\n\013path_mu_map\030\005 \001(\t\022\016\n\006use_nn\030\006 \002("
@@ -169,29 +190,43 @@ const char descriptor_table_protodef_recontaskparameter_2eproto[] PROTOBUF_SECTI
   "onstructed_tomographs_data\030\032 \003(\001\022\014\n\004done"
   "\030\033 \002(\010\022\016\n\006loaded\030\034 \002(\010\022\022\n\npath_model\030\035 \002"
   "(\t\022\025\n\rsinogram_info\030\036 \002(\t\022\022\n\nresolution\030"
-  "\037 \002(\005\"\224\001\n\014IteratorType\022\010\n\004MLEM\020\000\022\017\n\013EM_T"
-  "ikhonov\020\001\022\022\n\016PAPA_2DWavelet\020\002\022\r\n\tPAPA_Co"
-  "nt\020\003\022\020\n\014PAPA_Cont_TV\020\004\022\025\n\021PAPA_Cont_Wave"
-  "let\020\005\022\020\n\014PAPA_Dynamic\020\006\022\013\n\007PAPA_TV\020\007\"=\n\n"
-  "FileFormat\022\020\n\014RAW_SINOGRAM\020\000\022\022\n\016RAW_PROJ"
-  "ECTION\020\001\022\t\n\005DICOM\020\002\"\202\001\n\014FileDataType\022\013\n\007"
-  "FLOAT32\020\001\022\013\n\007FLOAT64\020\002\022\010\n\004INT8\020\003\022\t\n\005UINT"
-  "8\020\004\022\t\n\005INT16\020\005\022\n\n\006UINT16\020\006\022\t\n\005INT32\020\007\022\n\n"
-  "\006UINT32\020\010\022\t\n\005INT64\020\t\022\n\n\006UINT64\020\n"
+  "\037 \002(\005\022\032\n\022reconstruct_volume\030  \001(\010\022\026\n\013sli"
+  "ce_begin\030! \001(\005:\0010\022\025\n\tslice_end\030\" \001(\005:\002-1"
+  "\022\034\n\021snapshot_interval\030# \001(\005:\0015\022_\n\017model_"
+  "precision\030$ \001(\0162:.recontaskparameter_pb."
+  "ReconTaskParameterPB.ModelPrecision:\nMOD"
+  "EL_FP32\022e\n\017restored_output\030% \001(\0162:.recon"
+  "taskparameter_pb.ReconTaskParameterPB.Re"
+  "storedOutput:\020RESTORED_FLOAT64\"\224\001\n\014Itera"
+  "torType\022\010\n\004MLEM\020\000\022\017\n\013EM_Tikhonov\020\001\022\022\n\016PA"
+  "PA_2DWavelet\020\002\022\r\n\tPAPA_Cont\020\003\022\020\n\014PAPA_Co"
+  "nt_TV\020\004\022\025\n\021PAPA_Cont_Wavelet\020\005\022\020\n\014PAPA_D"
+  "ynamic\020\006\022\013\n\007PAPA_TV\020\007\"=\n\nFileFormat\022\020\n\014R"
+  "AW_SINOGRAM\020\000\022\022\n\016RAW_PROJECTION\020\001\022\t\n\005DIC"
+  "OM\020\002\"\202\001\n\014FileDataType\022\013\n\007FLOAT32\020\001\022\013\n\007FL"
+  "OAT64\020\002\022\010\n\004INT8\020\003\022\t\n\005UINT8\020\004\022\t\n\005INT16\020\005\022"
+  "\n\n\006UINT16\020\006\022\t\n\005INT32\020\007\022\n\n\006UINT32\020\010\022\t\n\005IN"
+  "T64\020\t\022\n\n\006UINT64\020\n\"@\n\016ModelPrecision\022\016\n\nM"
+  "ODEL_FP32\020\000\022\016\n\nMODEL_FP16\020\001\022\016\n\nMODEL_INT"
+  "8\020\002\"O\n\016RestoredOutput\022\021\n\rRESTORED_NONE\020\000"
+  "\022\024\n\020RESTORED_FLOAT32\020\001\022\024\n\020RESTORED_FLOAT"
+  "64\020\002"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_recontaskparameter_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_recontaskparameter_2eproto = {
-  false, false, 1272, descriptor_table_protodef_recontaskparameter_2eproto, "recontaskparameter.proto", 
-  &descriptor_table_recontaskparameter_2eproto_once, nullptr, 0, 1,
-  schemas, file_default_instances, TableStruct_recontaskparameter_2eproto::offsets,
-  file_level_metadata_recontaskparameter_2eproto, file_level_enum_descriptors_recontaskparameter_2eproto, file_level_service_descriptors_recontaskparameter_2eproto,
+static ::_pbi::once_flag descriptor_table_recontaskparameter_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_recontaskparameter_2eproto = {
+    false, false, 1724, descriptor_table_protodef_recontaskparameter_2eproto,
+    "recontaskparameter.proto",
+    &descriptor_table_recontaskparameter_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_recontaskparameter_2eproto::offsets,
+    file_level_metadata_recontaskparameter_2eproto, file_level_enum_descriptors_recontaskparameter_2eproto,
+    file_level_service_descriptors_recontaskparameter_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_recontaskparameter_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_recontaskparameter_2eproto_getter() {
   return &descriptor_table_recontaskparameter_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_recontaskparameter_2eproto(&descriptor_table_recontaskparameter_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_recontaskparameter_2eproto(&descriptor_table_recontaskparameter_2eproto);
 namespace recontaskparameter_pb {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReconTaskParameterPB_IteratorType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_recontaskparameter_2eproto);
@@ -286,12 +321,58 @@ constexpr ReconTaskParameterPB_FileDataType ReconTaskParameterPB::FileDataType_M
 constexpr ReconTaskParameterPB_FileDataType ReconTaskParameterPB::FileDataType_MAX;
 constexpr int ReconTaskParameterPB::FileDataType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReconTaskParameterPB_ModelPrecision_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_recontaskparameter_2eproto);
+  return file_level_enum_descriptors_recontaskparameter_2eproto[3];
+}
+bool ReconTaskParameterPB_ModelPrecision_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::MODEL_FP32;
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::MODEL_FP16;
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::MODEL_INT8;
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::ModelPrecision_MIN;
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::ModelPrecision_MAX;
+constexpr int ReconTaskParameterPB::ModelPrecision_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReconTaskParameterPB_RestoredOutput_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_recontaskparameter_2eproto);
+  return file_level_enum_descriptors_recontaskparameter_2eproto[4];
+}
+bool ReconTaskParameterPB_RestoredOutput_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::RESTORED_NONE;
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::RESTORED_FLOAT32;
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::RESTORED_FLOAT64;
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::RestoredOutput_MIN;
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::RestoredOutput_MAX;
+constexpr int ReconTaskParameterPB::RestoredOutput_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
 class ReconTaskParameterPB::_Internal {
  public:
-  using HasBits = decltype(std::declval<ReconTaskParameterPB>()._has_bits_);
+  using HasBits = decltype(std::declval<ReconTaskParameterPB>()._impl_._has_bits_);
   static void set_has_task_name(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
@@ -341,7 +422,7 @@ class ReconTaskParameterPB::_Internal {
     (*has_bits)[0] |= 32768u;
   }
   static void set_has_file_data_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 134217728u;
+    (*has_bits)[0] |= 1073741824u;
   }
   static void set_has_index_sinogram(HasBits* has_bits) {
     (*has_bits)[0] |= 1048576u;
@@ -376,167 +457,255 @@ class ReconTaskParameterPB::_Internal {
   static void set_has_resolution(HasBits* has_bits) {
     (*has_bits)[0] |= 67108864u;
   }
+  static void set_has_reconstruct_volume(HasBits* has_bits) {
+    (*has_bits)[0] |= 134217728u;
+  }
+  static void set_has_slice_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 268435456u;
+  }
+  static void set_has_slice_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 2147483648u;
+  }
+  static void set_has_snapshot_interval(HasBits* has_bits) {
+    (*has_bits)[1] |= 1u;
+  }
+  static void set_has_model_precision(HasBits* has_bits) {
+    (*has_bits)[0] |= 536870912u;
+  }
+  static void set_has_restored_output(HasBits* has_bits) {
+    (*has_bits)[1] |= 2u;
+  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x0fffefe7) ^ 0x0fffefe7) != 0;
+    return ((has_bits[0] & 0x47ffefe7) ^ 0x47ffefe7) != 0;
   }
 };
 
 ReconTaskParameterPB::ReconTaskParameterPB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  sinogram_data_(arena),
-  restored_sinogram_data_(arena),
-  reconstructed_tomographs_data_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:recontaskparameter_pb.ReconTaskParameterPB)
 }
 ReconTaskParameterPB::ReconTaskParameterPB(const ReconTaskParameterPB& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_),
-      sinogram_data_(from.sinogram_data_),
-      restored_sinogram_data_(from.restored_sinogram_data_),
-      reconstructed_tomographs_data_(from.reconstructed_tomographs_data_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReconTaskParameterPB* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sinogram_data_){from._impl_.sinogram_data_}
+    , decltype(_impl_.restored_sinogram_data_){from._impl_.restored_sinogram_data_}
+    , decltype(_impl_.reconstructed_tomographs_data_){from._impl_.reconstructed_tomographs_data_}
+    , decltype(_impl_.task_name_){}
+    , decltype(_impl_.path_sysmat_){}
+    , decltype(_impl_.path_sinogdram_){}
+    , decltype(_impl_.path_scatter_map_){}
+    , decltype(_impl_.path_mu_map_){}
+    , decltype(_impl_.output_dir_){}
+    , decltype(_impl_.path_model_){}
+    , decltype(_impl_.sinogram_info_){}
+    , decltype(_impl_.num_iters_){}
+    , decltype(_impl_.num_dual_iters_){}
+    , decltype(_impl_.gamma_){}
+    , decltype(_impl_.lambda_){}
+    , decltype(_impl_.coeff_scatter_){}
+    , decltype(_impl_.iterator_){}
+    , decltype(_impl_.file_format_){}
+    , decltype(_impl_.num_input_images_){}
+    , decltype(_impl_.use_nn_){}
+    , decltype(_impl_.use_scatter_map_){}
+    , decltype(_impl_.done_){}
+    , decltype(_impl_.loaded_){}
+    , decltype(_impl_.index_sinogram_){}
+    , decltype(_impl_.index_projection_){}
+    , decltype(_impl_.num_detectors_){}
+    , decltype(_impl_.num_angles_){}
+    , decltype(_impl_.num_slices_){}
+    , decltype(_impl_.num_results_){}
+    , decltype(_impl_.resolution_){}
+    , decltype(_impl_.reconstruct_volume_){}
+    , decltype(_impl_.slice_begin_){}
+    , decltype(_impl_.model_precision_){}
+    , decltype(_impl_.file_data_type_){}
+    , decltype(_impl_.slice_end_){}
+    , decltype(_impl_.snapshot_interval_){}
+    , decltype(_impl_.restored_output_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  task_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.task_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    task_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.task_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_task_name()) {
-    task_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_task_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.task_name_.Set(from._internal_task_name(), 
+      _this->GetArenaForAllocation());
   }
-  path_sysmat_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_sysmat_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    path_sysmat_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.path_sysmat_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_path_sysmat()) {
-    path_sysmat_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_path_sysmat(), 
-      GetArenaForAllocation());
+    _this->_impl_.path_sysmat_.Set(from._internal_path_sysmat(), 
+      _this->GetArenaForAllocation());
   }
-  path_sinogdram_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_sinogdram_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    path_sinogdram_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.path_sinogdram_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_path_sinogdram()) {
-    path_sinogdram_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_path_sinogdram(), 
-      GetArenaForAllocation());
+    _this->_impl_.path_sinogdram_.Set(from._internal_path_sinogdram(), 
+      _this->GetArenaForAllocation());
   }
-  path_scatter_map_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_scatter_map_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    path_scatter_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.path_scatter_map_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_path_scatter_map()) {
-    path_scatter_map_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_path_scatter_map(), 
-      GetArenaForAllocation());
+    _this->_impl_.path_scatter_map_.Set(from._internal_path_scatter_map(), 
+      _this->GetArenaForAllocation());
   }
-  path_mu_map_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_mu_map_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    path_mu_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.path_mu_map_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_path_mu_map()) {
-    path_mu_map_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_path_mu_map(), 
-      GetArenaForAllocation());
+    _this->_impl_.path_mu_map_.Set(from._internal_path_mu_map(), 
+      _this->GetArenaForAllocation());
   }
-  output_dir_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.output_dir_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    output_dir_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.output_dir_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_output_dir()) {
-    output_dir_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_output_dir(), 
-      GetArenaForAllocation());
+    _this->_impl_.output_dir_.Set(from._internal_output_dir(), 
+      _this->GetArenaForAllocation());
   }
-  path_model_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_model_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    path_model_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.path_model_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_path_model()) {
-    path_model_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_path_model(), 
-      GetArenaForAllocation());
+    _this->_impl_.path_model_.Set(from._internal_path_model(), 
+      _this->GetArenaForAllocation());
   }
-  sinogram_info_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.sinogram_info_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    sinogram_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.sinogram_info_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_sinogram_info()) {
-    sinogram_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_sinogram_info(), 
-      GetArenaForAllocation());
+    _this->_impl_.sinogram_info_.Set(from._internal_sinogram_info(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&num_iters_, &from.num_iters_,
-    static_cast<size_t>(reinterpret_cast<char*>(&file_data_type_) -
-    reinterpret_cast<char*>(&num_iters_)) + sizeof(file_data_type_));
+  ::memcpy(&_impl_.num_iters_, &from._impl_.num_iters_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.restored_output_) -
+    reinterpret_cast<char*>(&_impl_.num_iters_)) + sizeof(_impl_.restored_output_));
   // @@protoc_insertion_point(copy_constructor:recontaskparameter_pb.ReconTaskParameterPB)
 }
 
-inline void ReconTaskParameterPB::SharedCtor() {
-task_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  task_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-path_sysmat_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  path_sysmat_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-path_sinogdram_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  path_sinogdram_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-path_scatter_map_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  path_scatter_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-path_mu_map_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  path_mu_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-output_dir_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  output_dir_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-path_model_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  path_model_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-sinogram_info_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  sinogram_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&num_iters_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&resolution_) -
-    reinterpret_cast<char*>(&num_iters_)) + sizeof(resolution_));
-file_data_type_ = 1;
+inline void ReconTaskParameterPB::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sinogram_data_){arena}
+    , decltype(_impl_.restored_sinogram_data_){arena}
+    , decltype(_impl_.reconstructed_tomographs_data_){arena}
+    , decltype(_impl_.task_name_){}
+    , decltype(_impl_.path_sysmat_){}
+    , decltype(_impl_.path_sinogdram_){}
+    , decltype(_impl_.path_scatter_map_){}
+    , decltype(_impl_.path_mu_map_){}
+    , decltype(_impl_.output_dir_){}
+    , decltype(_impl_.path_model_){}
+    , decltype(_impl_.sinogram_info_){}
+    , decltype(_impl_.num_iters_){0}
+    , decltype(_impl_.num_dual_iters_){0}
+    , decltype(_impl_.gamma_){0}
+    , decltype(_impl_.lambda_){0}
+    , decltype(_impl_.coeff_scatter_){0}
+    , decltype(_impl_.iterator_){0}
+    , decltype(_impl_.file_format_){0}
+    , decltype(_impl_.num_input_images_){0}
+    , decltype(_impl_.use_nn_){false}
+    , decltype(_impl_.use_scatter_map_){false}
+    , decltype(_impl_.done_){false}
+    , decltype(_impl_.loaded_){false}
+    , decltype(_impl_.index_sinogram_){0}
+    , decltype(_impl_.index_projection_){0}
+    , decltype(_impl_.num_detectors_){0}
+    , decltype(_impl_.num_angles_){0}
+    , decltype(_impl_.num_slices_){0}
+    , decltype(_impl_.num_results_){0}
+    , decltype(_impl_.resolution_){0}
+    , decltype(_impl_.reconstruct_volume_){false}
+    , decltype(_impl_.slice_begin_){0}
+    , decltype(_impl_.model_precision_){0}
+    , decltype(_impl_.file_data_type_){1}
+    , decltype(_impl_.slice_end_){-1}
+    , decltype(_impl_.snapshot_interval_){5}
+    , decltype(_impl_.restored_output_){2}
+  };
+  _impl_.task_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_sysmat_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_sysmat_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_sinogdram_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_sinogdram_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_scatter_map_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_scatter_map_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_mu_map_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_mu_map_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.output_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_model_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_model_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sinogram_info_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sinogram_info_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ReconTaskParameterPB::~ReconTaskParameterPB() {
   // @@protoc_insertion_point(destructor:recontaskparameter_pb.ReconTaskParameterPB)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void ReconTaskParameterPB::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  task_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  path_sysmat_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  path_sinogdram_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  path_scatter_map_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  path_mu_map_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  output_dir_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  path_model_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  sinogram_info_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.sinogram_data_.~RepeatedField();
+  _impl_.restored_sinogram_data_.~RepeatedField();
+  _impl_.reconstructed_tomographs_data_.~RepeatedField();
+  _impl_.task_name_.Destroy();
+  _impl_.path_sysmat_.Destroy();
+  _impl_.path_sinogdram_.Destroy();
+  _impl_.path_scatter_map_.Destroy();
+  _impl_.path_mu_map_.Destroy();
+  _impl_.output_dir_.Destroy();
+  _impl_.path_model_.Destroy();
+  _impl_.sinogram_info_.Destroy();
 }
 
-void ReconTaskParameterPB::ArenaDtor(void* object) {
-  ReconTaskParameterPB* _this = reinterpret_cast< ReconTaskParameterPB* >(object);
-  (void)_this;
-}
-void ReconTaskParameterPB::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ReconTaskParameterPB::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void ReconTaskParameterPB::Clear() {
@@ -545,72 +714,77 @@ void ReconTaskParameterPB::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  sinogram_data_.Clear();
-  restored_sinogram_data_.Clear();
-  reconstructed_tomographs_data_.Clear();
-  cached_has_bits = _has_bits_[0];
+  _impl_.sinogram_data_.Clear();
+  _impl_.restored_sinogram_data_.Clear();
+  _impl_.reconstructed_tomographs_data_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
-      task_name_.ClearNonDefaultToEmpty();
+      _impl_.task_name_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000002u) {
-      path_sysmat_.ClearNonDefaultToEmpty();
+      _impl_.path_sysmat_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000004u) {
-      path_sinogdram_.ClearNonDefaultToEmpty();
+      _impl_.path_sinogdram_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000008u) {
-      path_scatter_map_.ClearNonDefaultToEmpty();
+      _impl_.path_scatter_map_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000010u) {
-      path_mu_map_.ClearNonDefaultToEmpty();
+      _impl_.path_mu_map_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000020u) {
-      output_dir_.ClearNonDefaultToEmpty();
+      _impl_.output_dir_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000040u) {
-      path_model_.ClearNonDefaultToEmpty();
+      _impl_.path_model_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000080u) {
-      sinogram_info_.ClearNonDefaultToEmpty();
+      _impl_.sinogram_info_.ClearNonDefaultToEmpty();
     }
   }
   if (cached_has_bits & 0x0000ff00u) {
-    ::memset(&num_iters_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&num_input_images_) -
-        reinterpret_cast<char*>(&num_iters_)) + sizeof(num_input_images_));
+    ::memset(&_impl_.num_iters_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_input_images_) -
+        reinterpret_cast<char*>(&_impl_.num_iters_)) + sizeof(_impl_.num_input_images_));
   }
   if (cached_has_bits & 0x00ff0000u) {
-    ::memset(&use_nn_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&num_angles_) -
-        reinterpret_cast<char*>(&use_nn_)) + sizeof(num_angles_));
-  }
-  if (cached_has_bits & 0x0f000000u) {
-    ::memset(&num_slices_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&resolution_) -
-        reinterpret_cast<char*>(&num_slices_)) + sizeof(resolution_));
-    file_data_type_ = 1;
-  }
-  _has_bits_.Clear();
+    ::memset(&_impl_.use_nn_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_angles_) -
+        reinterpret_cast<char*>(&_impl_.use_nn_)) + sizeof(_impl_.num_angles_));
+  }
+  if (cached_has_bits & 0xff000000u) {
+    ::memset(&_impl_.num_slices_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.model_precision_) -
+        reinterpret_cast<char*>(&_impl_.num_slices_)) + sizeof(_impl_.model_precision_));
+    _impl_.file_data_type_ = 1;
+    _impl_.slice_end_ = -1;
+  }
+  cached_has_bits = _impl_._has_bits_[1];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.snapshot_interval_ = 5;
+    _impl_.restored_output_ = 2;
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // required string task_name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_task_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.task_name");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.task_name");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -618,11 +792,11 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_path_sysmat();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_sysmat");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_sysmat");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -630,11 +804,11 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_path_sinogdram();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_sinogdram");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_sinogdram");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -642,11 +816,11 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_path_scatter_map();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_scatter_map");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_scatter_map");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -654,19 +828,19 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_path_mu_map();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_mu_map");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_mu_map");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
       // required bool use_nn = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _Internal::set_has_use_nn(&has_bits);
-          use_nn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _Internal::set_has_use_nn(&_impl_._has_bits_);
+          _impl_.use_nn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -674,8 +848,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required bool use_scatter_map = 7;
       case 7:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
-          _Internal::set_has_use_scatter_map(&has_bits);
-          use_scatter_map_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _Internal::set_has_use_scatter_map(&_impl_._has_bits_);
+          _impl_.use_scatter_map_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -683,8 +857,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_iters = 8;
       case 8:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          _Internal::set_has_num_iters(&has_bits);
-          num_iters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_iters(&_impl_._has_bits_);
+          _impl_.num_iters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -692,8 +866,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_dual_iters = 9;
       case 9:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
-          _Internal::set_has_num_dual_iters(&has_bits);
-          num_dual_iters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_dual_iters(&_impl_._has_bits_);
+          _impl_.num_dual_iters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -701,8 +875,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required double gamma = 10;
       case 10:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
-          _Internal::set_has_gamma(&has_bits);
-          gamma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _Internal::set_has_gamma(&_impl_._has_bits_);
+          _impl_.gamma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -710,8 +884,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required double lambda = 11;
       case 11:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
-          _Internal::set_has_lambda(&has_bits);
-          lambda_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _Internal::set_has_lambda(&_impl_._has_bits_);
+          _impl_.lambda_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -719,8 +893,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional double coeff_scatter = 12;
       case 12:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
-          _Internal::set_has_coeff_scatter(&has_bits);
-          coeff_scatter_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _Internal::set_has_coeff_scatter(&_impl_._has_bits_);
+          _impl_.coeff_scatter_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -729,11 +903,11 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 13:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
           auto str = _internal_mutable_output_dir();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.output_dir");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.output_dir");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -766,8 +940,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_input_images = 16;
       case 16:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
-          _Internal::set_has_num_input_images(&has_bits);
-          num_input_images_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_input_images(&_impl_._has_bits_);
+          _impl_.num_input_images_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -788,8 +962,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 index_sinogram = 18;
       case 18:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
-          _Internal::set_has_index_sinogram(&has_bits);
-          index_sinogram_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_index_sinogram(&_impl_._has_bits_);
+          _impl_.index_sinogram_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -797,8 +971,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 index_projection = 19;
       case 19:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
-          _Internal::set_has_index_projection(&has_bits);
-          index_projection_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_index_projection(&_impl_._has_bits_);
+          _impl_.index_projection_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -806,8 +980,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_detectors = 20;
       case 20:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
-          _Internal::set_has_num_detectors(&has_bits);
-          num_detectors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_detectors(&_impl_._has_bits_);
+          _impl_.num_detectors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -815,8 +989,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_angles = 21;
       case 21:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
-          _Internal::set_has_num_angles(&has_bits);
-          num_angles_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_angles(&_impl_._has_bits_);
+          _impl_.num_angles_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -824,8 +998,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_slices = 22;
       case 22:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
-          _Internal::set_has_num_slices(&has_bits);
-          num_slices_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_slices(&_impl_._has_bits_);
+          _impl_.num_slices_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -833,8 +1007,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required int32 num_results = 23;
       case 23:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
-          _Internal::set_has_num_results(&has_bits);
-          num_results_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_num_results(&_impl_._has_bits_);
+          _impl_.num_results_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -890,8 +1064,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required bool done = 27;
       case 27:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 216)) {
-          _Internal::set_has_done(&has_bits);
-          done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _Internal::set_has_done(&_impl_._has_bits_);
+          _impl_.done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -899,8 +1073,8 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // required bool loaded = 28;
       case 28:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 224)) {
-          _Internal::set_has_loaded(&has_bits);
-          loaded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _Internal::set_has_loaded(&_impl_._has_bits_);
+          _impl_.loaded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -909,11 +1083,11 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 29:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 234)) {
           auto str = _internal_mutable_path_model();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_model");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.path_model");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -921,23 +1095,85 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 30:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
           auto str = _internal_mutable_sinogram_info();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.sinogram_info");
+          ::_pbi::VerifyUTF8(str, "recontaskparameter_pb.ReconTaskParameterPB.sinogram_info");
           #endif  // !NDEBUG
-          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
       // required int32 resolution = 31;
       case 31:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 248)) {
-          _Internal::set_has_resolution(&has_bits);
-          resolution_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _Internal::set_has_resolution(&_impl_._has_bits_);
+          _impl_.resolution_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool reconstruct_volume = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 0)) {
+          _Internal::set_has_reconstruct_volume(&_impl_._has_bits_);
+          _impl_.reconstruct_volume_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 slice_begin = 33 [default = 0];
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_slice_begin(&_impl_._has_bits_);
+          _impl_.slice_begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 slice_end = 34 [default = -1];
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_slice_end(&_impl_._has_bits_);
+          _impl_.slice_end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
+      // optional int32 snapshot_interval = 35 [default = 5];
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_snapshot_interval(&_impl_._has_bits_);
+          _impl_.snapshot_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .recontaskparameter_pb.ReconTaskParameterPB.ModelPrecision model_precision = 36 [default = MODEL_FP32];
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision_IsValid(val))) {
+            _internal_set_model_precision(static_cast<::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(36, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .recontaskparameter_pb.ReconTaskParameterPB.RestoredOutput restored_output = 37 [default = RESTORED_FLOAT64];
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput_IsValid(val))) {
+            _internal_set_restored_output(static_cast<::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(37, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -954,7 +1190,6 @@ const char* ReconTaskParameterPB::_InternalParse(const char* ptr, ::PROTOBUF_NAM
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -968,7 +1203,7 @@ uint8_t* ReconTaskParameterPB::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // required string task_name = 1;
   if (cached_has_bits & 0x00000001u) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
@@ -1022,43 +1257,43 @@ uint8_t* ReconTaskParameterPB::_InternalSerialize(
   // required bool use_nn = 6;
   if (cached_has_bits & 0x00010000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->_internal_use_nn(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_use_nn(), target);
   }
 
   // required bool use_scatter_map = 7;
   if (cached_has_bits & 0x00020000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(7, this->_internal_use_scatter_map(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_use_scatter_map(), target);
   }
 
   // required int32 num_iters = 8;
   if (cached_has_bits & 0x00000100u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_num_iters(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_num_iters(), target);
   }
 
   // required int32 num_dual_iters = 9;
   if (cached_has_bits & 0x00000200u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(9, this->_internal_num_dual_iters(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_num_dual_iters(), target);
   }
 
   // required double gamma = 10;
   if (cached_has_bits & 0x00000400u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(10, this->_internal_gamma(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_gamma(), target);
   }
 
   // required double lambda = 11;
   if (cached_has_bits & 0x00000800u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(11, this->_internal_lambda(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_lambda(), target);
   }
 
   // optional double coeff_scatter = 12;
   if (cached_has_bits & 0x00001000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(12, this->_internal_coeff_scatter(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_coeff_scatter(), target);
   }
 
   // required string output_dir = 13;
@@ -1074,94 +1309,94 @@ uint8_t* ReconTaskParameterPB::_InternalSerialize(
   // required .recontaskparameter_pb.ReconTaskParameterPB.IteratorType iterator = 14;
   if (cached_has_bits & 0x00002000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       14, this->_internal_iterator(), target);
   }
 
   // required .recontaskparameter_pb.ReconTaskParameterPB.FileFormat file_format = 15;
   if (cached_has_bits & 0x00004000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       15, this->_internal_file_format(), target);
   }
 
   // required int32 num_input_images = 16;
   if (cached_has_bits & 0x00008000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(16, this->_internal_num_input_images(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_num_input_images(), target);
   }
 
   // required .recontaskparameter_pb.ReconTaskParameterPB.FileDataType file_data_type = 17;
-  if (cached_has_bits & 0x08000000u) {
+  if (cached_has_bits & 0x40000000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       17, this->_internal_file_data_type(), target);
   }
 
   // required int32 index_sinogram = 18;
   if (cached_has_bits & 0x00100000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(18, this->_internal_index_sinogram(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_index_sinogram(), target);
   }
 
   // required int32 index_projection = 19;
   if (cached_has_bits & 0x00200000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(19, this->_internal_index_projection(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(19, this->_internal_index_projection(), target);
   }
 
   // required int32 num_detectors = 20;
   if (cached_has_bits & 0x00400000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(20, this->_internal_num_detectors(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(20, this->_internal_num_detectors(), target);
   }
 
   // required int32 num_angles = 21;
   if (cached_has_bits & 0x00800000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(21, this->_internal_num_angles(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(21, this->_internal_num_angles(), target);
   }
 
   // required int32 num_slices = 22;
   if (cached_has_bits & 0x01000000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(22, this->_internal_num_slices(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(22, this->_internal_num_slices(), target);
   }
 
   // required int32 num_results = 23;
   if (cached_has_bits & 0x02000000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(23, this->_internal_num_results(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(23, this->_internal_num_results(), target);
   }
 
   // repeated double sinogram_data = 24;
   for (int i = 0, n = this->_internal_sinogram_data_size(); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(24, this->_internal_sinogram_data(i), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(24, this->_internal_sinogram_data(i), target);
   }
 
   // repeated double restored_sinogram_data = 25;
   for (int i = 0, n = this->_internal_restored_sinogram_data_size(); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(25, this->_internal_restored_sinogram_data(i), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(25, this->_internal_restored_sinogram_data(i), target);
   }
 
   // repeated double reconstructed_tomographs_data = 26;
   for (int i = 0, n = this->_internal_reconstructed_tomographs_data_size(); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(26, this->_internal_reconstructed_tomographs_data(i), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(26, this->_internal_reconstructed_tomographs_data(i), target);
   }
 
   // required bool done = 27;
   if (cached_has_bits & 0x00040000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(27, this->_internal_done(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(27, this->_internal_done(), target);
   }
 
   // required bool loaded = 28;
   if (cached_has_bits & 0x00080000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(28, this->_internal_loaded(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(28, this->_internal_loaded(), target);
   }
 
   // required string path_model = 29;
@@ -1187,11 +1422,52 @@ uint8_t* ReconTaskParameterPB::_InternalSerialize(
   // required int32 resolution = 31;
   if (cached_has_bits & 0x04000000u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(31, this->_internal_resolution(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(31, this->_internal_resolution(), target);
+  }
+
+  // optional bool reconstruct_volume = 32;
+  if (cached_has_bits & 0x08000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(32, this->_internal_reconstruct_volume(), target);
+  }
+
+  // optional int32 slice_begin = 33 [default = 0];
+  if (cached_has_bits & 0x10000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(33, this->_internal_slice_begin(), target);
+  }
+
+  // optional int32 slice_end = 34 [default = -1];
+  if (cached_has_bits & 0x80000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(34, this->_internal_slice_end(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  // optional int32 snapshot_interval = 35 [default = 5];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(35, this->_internal_snapshot_interval(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .recontaskparameter_pb.ReconTaskParameterPB.ModelPrecision model_precision = 36 [default = MODEL_FP32];
+  if (cached_has_bits & 0x20000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      36, this->_internal_model_precision(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  // optional .recontaskparameter_pb.ReconTaskParameterPB.RestoredOutput restored_output = 37 [default = RESTORED_FLOAT64];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      37, this->_internal_restored_output(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:recontaskparameter_pb.ReconTaskParameterPB)
@@ -1246,12 +1522,12 @@ size_t ReconTaskParameterPB::RequiredFieldsByteSizeFallback() const {
 
   if (_internal_has_num_iters()) {
     // required int32 num_iters = 8;
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_num_iters());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_iters());
   }
 
   if (_internal_has_num_dual_iters()) {
     // required int32 num_dual_iters = 9;
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_num_dual_iters());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_dual_iters());
   }
 
   if (_internal_has_gamma()) {
@@ -1267,19 +1543,19 @@ size_t ReconTaskParameterPB::RequiredFieldsByteSizeFallback() const {
   if (_internal_has_iterator()) {
     // required .recontaskparameter_pb.ReconTaskParameterPB.IteratorType iterator = 14;
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_iterator());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_iterator());
   }
 
   if (_internal_has_file_format()) {
     // required .recontaskparameter_pb.ReconTaskParameterPB.FileFormat file_format = 15;
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_file_format());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_file_format());
   }
 
   if (_internal_has_num_input_images()) {
     // required int32 num_input_images = 16;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_input_images());
   }
 
@@ -1306,56 +1582,56 @@ size_t ReconTaskParameterPB::RequiredFieldsByteSizeFallback() const {
   if (_internal_has_index_sinogram()) {
     // required int32 index_sinogram = 18;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_index_sinogram());
   }
 
   if (_internal_has_index_projection()) {
     // required int32 index_projection = 19;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_index_projection());
   }
 
   if (_internal_has_num_detectors()) {
     // required int32 num_detectors = 20;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_detectors());
   }
 
   if (_internal_has_num_angles()) {
     // required int32 num_angles = 21;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_angles());
   }
 
   if (_internal_has_num_slices()) {
     // required int32 num_slices = 22;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_slices());
   }
 
   if (_internal_has_num_results()) {
     // required int32 num_results = 23;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_results());
   }
 
   if (_internal_has_resolution()) {
     // required int32 resolution = 31;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_resolution());
   }
 
   if (_internal_has_file_data_type()) {
     // required .recontaskparameter_pb.ReconTaskParameterPB.FileDataType file_data_type = 17;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_file_data_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_file_data_type());
   }
 
   return total_size;
@@ -1364,7 +1640,7 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:recontaskparameter_pb.ReconTaskParameterPB)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x0fffefe7) ^ 0x0fffefe7) == 0) {  // All required fields are present.
+  if (((_impl_._has_bits_[0] & 0x47ffefe7) ^ 0x47ffefe7) == 0) {  // All required fields are present.
     // required string task_name = 1;
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
@@ -1396,10 +1672,10 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
         this->_internal_sinogram_info());
 
     // required int32 num_iters = 8;
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_num_iters());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_iters());
 
     // required int32 num_dual_iters = 9;
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_num_dual_iters());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_dual_iters());
 
     // required double gamma = 10;
     total_size += 1 + 8;
@@ -1409,15 +1685,15 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
 
     // required .recontaskparameter_pb.ReconTaskParameterPB.IteratorType iterator = 14;
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_iterator());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_iterator());
 
     // required .recontaskparameter_pb.ReconTaskParameterPB.FileFormat file_format = 15;
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_file_format());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_file_format());
 
     // required int32 num_input_images = 16;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_input_images());
 
     // required bool use_nn = 6;
@@ -1434,42 +1710,42 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
 
     // required int32 index_sinogram = 18;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_index_sinogram());
 
     // required int32 index_projection = 19;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_index_projection());
 
     // required int32 num_detectors = 20;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_detectors());
 
     // required int32 num_angles = 21;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_angles());
 
     // required int32 num_slices = 22;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_slices());
 
     // required int32 num_results = 23;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_num_results());
 
     // required int32 resolution = 31;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+      ::_pbi::WireFormatLite::Int32Size(
         this->_internal_resolution());
 
     // required .recontaskparameter_pb.ReconTaskParameterPB.FileDataType file_data_type = 17;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_file_data_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_file_data_type());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
@@ -1483,7 +1759,7 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
     unsigned int count = static_cast<unsigned int>(this->_internal_sinogram_data_size());
     size_t data_size = 8UL * count;
     total_size += 2 *
-                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_sinogram_data_size());
+                  ::_pbi::FromIntSize(this->_internal_sinogram_data_size());
     total_size += data_size;
   }
 
@@ -1492,7 +1768,7 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
     unsigned int count = static_cast<unsigned int>(this->_internal_restored_sinogram_data_size());
     size_t data_size = 8UL * count;
     total_size += 2 *
-                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_restored_sinogram_data_size());
+                  ::_pbi::FromIntSize(this->_internal_restored_sinogram_data_size());
     total_size += data_size;
   }
 
@@ -1501,11 +1777,11 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
     unsigned int count = static_cast<unsigned int>(this->_internal_reconstructed_tomographs_data_size());
     size_t data_size = 8UL * count;
     total_size += 2 *
-                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_reconstructed_tomographs_data_size());
+                  ::_pbi::FromIntSize(this->_internal_reconstructed_tomographs_data_size());
     total_size += data_size;
   }
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000018u) {
     // optional string path_scatter_map = 4;
     if (cached_has_bits & 0x00000008u) {
@@ -1527,128 +1803,189 @@ size_t ReconTaskParameterPB::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  if (cached_has_bits & 0x38000000u) {
+    // optional bool reconstruct_volume = 32;
+    if (cached_has_bits & 0x08000000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional int32 slice_begin = 33 [default = 0];
+    if (cached_has_bits & 0x10000000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_slice_begin());
+    }
+
+    // optional .recontaskparameter_pb.ReconTaskParameterPB.ModelPrecision model_precision = 36 [default = MODEL_FP32];
+    if (cached_has_bits & 0x20000000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_model_precision());
+    }
+
+  }
+  // optional int32 slice_end = 34 [default = -1];
+  if (cached_has_bits & 0x80000000u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_slice_end());
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 snapshot_interval = 35 [default = 5];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_snapshot_interval());
+    }
+
+    // optional .recontaskparameter_pb.ReconTaskParameterPB.RestoredOutput restored_output = 37 [default = RESTORED_FLOAT64];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_restored_output());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReconTaskParameterPB::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     ReconTaskParameterPB::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReconTaskParameterPB::GetClassData() const { return &_class_data_; }
 
-void ReconTaskParameterPB::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<ReconTaskParameterPB *>(to)->MergeFrom(
-      static_cast<const ReconTaskParameterPB &>(from));
-}
-
 
-void ReconTaskParameterPB::MergeFrom(const ReconTaskParameterPB& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recontaskparameter_pb.ReconTaskParameterPB)
-  GOOGLE_DCHECK_NE(&from, this);
+void ReconTaskParameterPB::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReconTaskParameterPB*>(&to_msg);
+  auto& from = static_cast<const ReconTaskParameterPB&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:recontaskparameter_pb.ReconTaskParameterPB)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  sinogram_data_.MergeFrom(from.sinogram_data_);
-  restored_sinogram_data_.MergeFrom(from.restored_sinogram_data_);
-  reconstructed_tomographs_data_.MergeFrom(from.reconstructed_tomographs_data_);
-  cached_has_bits = from._has_bits_[0];
+  _this->_impl_.sinogram_data_.MergeFrom(from._impl_.sinogram_data_);
+  _this->_impl_.restored_sinogram_data_.MergeFrom(from._impl_.restored_sinogram_data_);
+  _this->_impl_.reconstructed_tomographs_data_.MergeFrom(from._impl_.reconstructed_tomographs_data_);
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_set_task_name(from._internal_task_name());
+      _this->_internal_set_task_name(from._internal_task_name());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_set_path_sysmat(from._internal_path_sysmat());
+      _this->_internal_set_path_sysmat(from._internal_path_sysmat());
     }
     if (cached_has_bits & 0x00000004u) {
-      _internal_set_path_sinogdram(from._internal_path_sinogdram());
+      _this->_internal_set_path_sinogdram(from._internal_path_sinogdram());
     }
     if (cached_has_bits & 0x00000008u) {
-      _internal_set_path_scatter_map(from._internal_path_scatter_map());
+      _this->_internal_set_path_scatter_map(from._internal_path_scatter_map());
     }
     if (cached_has_bits & 0x00000010u) {
-      _internal_set_path_mu_map(from._internal_path_mu_map());
+      _this->_internal_set_path_mu_map(from._internal_path_mu_map());
     }
     if (cached_has_bits & 0x00000020u) {
-      _internal_set_output_dir(from._internal_output_dir());
+      _this->_internal_set_output_dir(from._internal_output_dir());
     }
     if (cached_has_bits & 0x00000040u) {
-      _internal_set_path_model(from._internal_path_model());
+      _this->_internal_set_path_model(from._internal_path_model());
     }
     if (cached_has_bits & 0x00000080u) {
-      _internal_set_sinogram_info(from._internal_sinogram_info());
+      _this->_internal_set_sinogram_info(from._internal_sinogram_info());
     }
   }
   if (cached_has_bits & 0x0000ff00u) {
     if (cached_has_bits & 0x00000100u) {
-      num_iters_ = from.num_iters_;
+      _this->_impl_.num_iters_ = from._impl_.num_iters_;
     }
     if (cached_has_bits & 0x00000200u) {
-      num_dual_iters_ = from.num_dual_iters_;
+      _this->_impl_.num_dual_iters_ = from._impl_.num_dual_iters_;
     }
     if (cached_has_bits & 0x00000400u) {
-      gamma_ = from.gamma_;
+      _this->_impl_.gamma_ = from._impl_.gamma_;
     }
     if (cached_has_bits & 0x00000800u) {
-      lambda_ = from.lambda_;
+      _this->_impl_.lambda_ = from._impl_.lambda_;
     }
     if (cached_has_bits & 0x00001000u) {
-      coeff_scatter_ = from.coeff_scatter_;
+      _this->_impl_.coeff_scatter_ = from._impl_.coeff_scatter_;
     }
     if (cached_has_bits & 0x00002000u) {
-      iterator_ = from.iterator_;
+      _this->_impl_.iterator_ = from._impl_.iterator_;
     }
     if (cached_has_bits & 0x00004000u) {
-      file_format_ = from.file_format_;
+      _this->_impl_.file_format_ = from._impl_.file_format_;
     }
     if (cached_has_bits & 0x00008000u) {
-      num_input_images_ = from.num_input_images_;
+      _this->_impl_.num_input_images_ = from._impl_.num_input_images_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   if (cached_has_bits & 0x00ff0000u) {
     if (cached_has_bits & 0x00010000u) {
-      use_nn_ = from.use_nn_;
+      _this->_impl_.use_nn_ = from._impl_.use_nn_;
     }
     if (cached_has_bits & 0x00020000u) {
-      use_scatter_map_ = from.use_scatter_map_;
+      _this->_impl_.use_scatter_map_ = from._impl_.use_scatter_map_;
     }
     if (cached_has_bits & 0x00040000u) {
-      done_ = from.done_;
+      _this->_impl_.done_ = from._impl_.done_;
     }
     if (cached_has_bits & 0x00080000u) {
-      loaded_ = from.loaded_;
+      _this->_impl_.loaded_ = from._impl_.loaded_;
     }
     if (cached_has_bits & 0x00100000u) {
-      index_sinogram_ = from.index_sinogram_;
+      _this->_impl_.index_sinogram_ = from._impl_.index_sinogram_;
     }
     if (cached_has_bits & 0x00200000u) {
-      index_projection_ = from.index_projection_;
+      _this->_impl_.index_projection_ = from._impl_.index_projection_;
     }
     if (cached_has_bits & 0x00400000u) {
-      num_detectors_ = from.num_detectors_;
+      _this->_impl_.num_detectors_ = from._impl_.num_detectors_;
     }
     if (cached_has_bits & 0x00800000u) {
-      num_angles_ = from.num_angles_;
+      _this->_impl_.num_angles_ = from._impl_.num_angles_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (cached_has_bits & 0x0f000000u) {
+  if (cached_has_bits & 0xff000000u) {
     if (cached_has_bits & 0x01000000u) {
-      num_slices_ = from.num_slices_;
+      _this->_impl_.num_slices_ = from._impl_.num_slices_;
     }
     if (cached_has_bits & 0x02000000u) {
-      num_results_ = from.num_results_;
+      _this->_impl_.num_results_ = from._impl_.num_results_;
     }
     if (cached_has_bits & 0x04000000u) {
-      resolution_ = from.resolution_;
+      _this->_impl_.resolution_ = from._impl_.resolution_;
     }
     if (cached_has_bits & 0x08000000u) {
-      file_data_type_ = from.file_data_type_;
+      _this->_impl_.reconstruct_volume_ = from._impl_.reconstruct_volume_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    if (cached_has_bits & 0x10000000u) {
+      _this->_impl_.slice_begin_ = from._impl_.slice_begin_;
+    }
+    if (cached_has_bits & 0x20000000u) {
+      _this->_impl_.model_precision_ = from._impl_.model_precision_;
+    }
+    if (cached_has_bits & 0x40000000u) {
+      _this->_impl_.file_data_type_ = from._impl_.file_data_type_;
+    }
+    if (cached_has_bits & 0x80000000u) {
+      _this->_impl_.slice_end_ = from._impl_.slice_end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  cached_has_bits = from._impl_._has_bits_[1];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.snapshot_interval_ = from._impl_.snapshot_interval_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.restored_output_ = from._impl_.restored_output_;
+    }
+    _this->_impl_._has_bits_[1] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ReconTaskParameterPB::CopyFrom(const ReconTaskParameterPB& from) {
@@ -1659,7 +1996,7 @@ void ReconTaskParameterPB::CopyFrom(const ReconTaskParameterPB& from) {
 }
 
 bool ReconTaskParameterPB::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
@@ -1668,61 +2005,57 @@ void ReconTaskParameterPB::InternalSwap(ReconTaskParameterPB* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  sinogram_data_.InternalSwap(&other->sinogram_data_);
-  restored_sinogram_data_.InternalSwap(&other->restored_sinogram_data_);
-  reconstructed_tomographs_data_.InternalSwap(&other->reconstructed_tomographs_data_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_._has_bits_[1], other->_impl_._has_bits_[1]);
+  _impl_.sinogram_data_.InternalSwap(&other->_impl_.sinogram_data_);
+  _impl_.restored_sinogram_data_.InternalSwap(&other->_impl_.restored_sinogram_data_);
+  _impl_.reconstructed_tomographs_data_.InternalSwap(&other->_impl_.reconstructed_tomographs_data_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &task_name_, lhs_arena,
-      &other->task_name_, rhs_arena
+      &_impl_.task_name_, lhs_arena,
+      &other->_impl_.task_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &path_sysmat_, lhs_arena,
-      &other->path_sysmat_, rhs_arena
+      &_impl_.path_sysmat_, lhs_arena,
+      &other->_impl_.path_sysmat_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &path_sinogdram_, lhs_arena,
-      &other->path_sinogdram_, rhs_arena
+      &_impl_.path_sinogdram_, lhs_arena,
+      &other->_impl_.path_sinogdram_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &path_scatter_map_, lhs_arena,
-      &other->path_scatter_map_, rhs_arena
+      &_impl_.path_scatter_map_, lhs_arena,
+      &other->_impl_.path_scatter_map_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &path_mu_map_, lhs_arena,
-      &other->path_mu_map_, rhs_arena
+      &_impl_.path_mu_map_, lhs_arena,
+      &other->_impl_.path_mu_map_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &output_dir_, lhs_arena,
-      &other->output_dir_, rhs_arena
+      &_impl_.output_dir_, lhs_arena,
+      &other->_impl_.output_dir_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &path_model_, lhs_arena,
-      &other->path_model_, rhs_arena
+      &_impl_.path_model_, lhs_arena,
+      &other->_impl_.path_model_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &sinogram_info_, lhs_arena,
-      &other->sinogram_info_, rhs_arena
+      &_impl_.sinogram_info_, lhs_arena,
+      &other->_impl_.sinogram_info_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ReconTaskParameterPB, resolution_)
-      + sizeof(ReconTaskParameterPB::resolution_)
-      - PROTOBUF_FIELD_OFFSET(ReconTaskParameterPB, num_iters_)>(
-          reinterpret_cast<char*>(&num_iters_),
-          reinterpret_cast<char*>(&other->num_iters_));
-  swap(file_data_type_, other->file_data_type_);
+      PROTOBUF_FIELD_OFFSET(ReconTaskParameterPB, _impl_.model_precision_)
+      + sizeof(ReconTaskParameterPB::_impl_.model_precision_)
+      - PROTOBUF_FIELD_OFFSET(ReconTaskParameterPB, _impl_.num_iters_)>(
+          reinterpret_cast<char*>(&_impl_.num_iters_),
+          reinterpret_cast<char*>(&other->_impl_.num_iters_));
+  swap(_impl_.file_data_type_, other->_impl_.file_data_type_);
+  swap(_impl_.slice_end_, other->_impl_.slice_end_);
+  swap(_impl_.snapshot_interval_, other->_impl_.snapshot_interval_);
+  swap(_impl_.restored_output_, other->_impl_.restored_output_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ReconTaskParameterPB::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_recontaskparameter_2eproto_getter, &descriptor_table_recontaskparameter_2eproto_once,
       file_level_metadata_recontaskparameter_2eproto[0]);
 }
@@ -1730,7 +2063,8 @@ void ReconTaskParameterPB::InternalSwap(ReconTaskParameterPB* other) {
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace recontaskparameter_pb
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::recontaskparameter_pb::ReconTaskParameterPB* Arena::CreateMaybeMessage< ::recontaskparameter_pb::ReconTaskParameterPB >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::recontaskparameter_pb::ReconTaskParameterPB*
+Arena::CreateMaybeMessage< ::recontaskparameter_pb::ReconTaskParameterPB >(Arena* arena) {
   return Arena::CreateMessageInternal< ::recontaskparameter_pb::ReconTaskParameterPB >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -4,18 +4,16 @@
 #ifndef GOOGLE_PROTOBUF_INCLUDED_recontaskparameter_2eproto
 #define GOOGLE_PROTOBUF_INCLUDED_recontaskparameter_2eproto
 
-#define PROTOBUF_USE_DLLS
-
 #include <limits>
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019001 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -25,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -45,14 +42,6 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_recontaskparameter_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_recontaskparameter_2eproto;
@@ -150,6 +139,54 @@ inline bool ReconTaskParameterPB_FileDataType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReconTaskParameterPB_FileDataType>(
     ReconTaskParameterPB_FileDataType_descriptor(), name, value);
 }
+enum ReconTaskParameterPB_ModelPrecision : int {
+  ReconTaskParameterPB_ModelPrecision_MODEL_FP32 = 0,
+  ReconTaskParameterPB_ModelPrecision_MODEL_FP16 = 1,
+  ReconTaskParameterPB_ModelPrecision_MODEL_INT8 = 2
+};
+bool ReconTaskParameterPB_ModelPrecision_IsValid(int value);
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB_ModelPrecision_ModelPrecision_MIN = ReconTaskParameterPB_ModelPrecision_MODEL_FP32;
+constexpr ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB_ModelPrecision_ModelPrecision_MAX = ReconTaskParameterPB_ModelPrecision_MODEL_INT8;
+constexpr int ReconTaskParameterPB_ModelPrecision_ModelPrecision_ARRAYSIZE = ReconTaskParameterPB_ModelPrecision_ModelPrecision_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReconTaskParameterPB_ModelPrecision_descriptor();
+template<typename T>
+inline const std::string& ReconTaskParameterPB_ModelPrecision_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReconTaskParameterPB_ModelPrecision>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReconTaskParameterPB_ModelPrecision_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReconTaskParameterPB_ModelPrecision_descriptor(), enum_t_value);
+}
+inline bool ReconTaskParameterPB_ModelPrecision_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReconTaskParameterPB_ModelPrecision* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReconTaskParameterPB_ModelPrecision>(
+    ReconTaskParameterPB_ModelPrecision_descriptor(), name, value);
+}
+enum ReconTaskParameterPB_RestoredOutput : int {
+  ReconTaskParameterPB_RestoredOutput_RESTORED_NONE = 0,
+  ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT32 = 1,
+  ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT64 = 2
+};
+bool ReconTaskParameterPB_RestoredOutput_IsValid(int value);
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB_RestoredOutput_RestoredOutput_MIN = ReconTaskParameterPB_RestoredOutput_RESTORED_NONE;
+constexpr ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB_RestoredOutput_RestoredOutput_MAX = ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT64;
+constexpr int ReconTaskParameterPB_RestoredOutput_RestoredOutput_ARRAYSIZE = ReconTaskParameterPB_RestoredOutput_RestoredOutput_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReconTaskParameterPB_RestoredOutput_descriptor();
+template<typename T>
+inline const std::string& ReconTaskParameterPB_RestoredOutput_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReconTaskParameterPB_RestoredOutput>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReconTaskParameterPB_RestoredOutput_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReconTaskParameterPB_RestoredOutput_descriptor(), enum_t_value);
+}
+inline bool ReconTaskParameterPB_RestoredOutput_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReconTaskParameterPB_RestoredOutput* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReconTaskParameterPB_RestoredOutput>(
+    ReconTaskParameterPB_RestoredOutput_descriptor(), name, value);
+}
 // ===================================================================
 
 class ReconTaskParameterPB final :
@@ -157,7 +194,7 @@ class ReconTaskParameterPB final :
  public:
   inline ReconTaskParameterPB() : ReconTaskParameterPB(nullptr) {}
   ~ReconTaskParameterPB() override;
-  explicit constexpr ReconTaskParameterPB(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ReconTaskParameterPB(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReconTaskParameterPB(const ReconTaskParameterPB& from);
   ReconTaskParameterPB(ReconTaskParameterPB&& from) noexcept
@@ -239,9 +276,11 @@ class ReconTaskParameterPB final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReconTaskParameterPB& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const ReconTaskParameterPB& from);
+  void MergeFrom( const ReconTaskParameterPB& from) {
+    ReconTaskParameterPB::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -250,10 +289,10 @@ class ReconTaskParameterPB final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReconTaskParameterPB* other);
@@ -266,9 +305,6 @@ class ReconTaskParameterPB final :
   protected:
   explicit ReconTaskParameterPB(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -398,6 +434,70 @@ class ReconTaskParameterPB final :
     return ReconTaskParameterPB_FileDataType_Parse(name, value);
   }
 
+  typedef ReconTaskParameterPB_ModelPrecision ModelPrecision;
+  static constexpr ModelPrecision MODEL_FP32 =
+    ReconTaskParameterPB_ModelPrecision_MODEL_FP32;
+  static constexpr ModelPrecision MODEL_FP16 =
+    ReconTaskParameterPB_ModelPrecision_MODEL_FP16;
+  static constexpr ModelPrecision MODEL_INT8 =
+    ReconTaskParameterPB_ModelPrecision_MODEL_INT8;
+  static inline bool ModelPrecision_IsValid(int value) {
+    return ReconTaskParameterPB_ModelPrecision_IsValid(value);
+  }
+  static constexpr ModelPrecision ModelPrecision_MIN =
+    ReconTaskParameterPB_ModelPrecision_ModelPrecision_MIN;
+  static constexpr ModelPrecision ModelPrecision_MAX =
+    ReconTaskParameterPB_ModelPrecision_ModelPrecision_MAX;
+  static constexpr int ModelPrecision_ARRAYSIZE =
+    ReconTaskParameterPB_ModelPrecision_ModelPrecision_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ModelPrecision_descriptor() {
+    return ReconTaskParameterPB_ModelPrecision_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ModelPrecision_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ModelPrecision>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ModelPrecision_Name.");
+    return ReconTaskParameterPB_ModelPrecision_Name(enum_t_value);
+  }
+  static inline bool ModelPrecision_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ModelPrecision* value) {
+    return ReconTaskParameterPB_ModelPrecision_Parse(name, value);
+  }
+
+  typedef ReconTaskParameterPB_RestoredOutput RestoredOutput;
+  static constexpr RestoredOutput RESTORED_NONE =
+    ReconTaskParameterPB_RestoredOutput_RESTORED_NONE;
+  static constexpr RestoredOutput RESTORED_FLOAT32 =
+    ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT32;
+  static constexpr RestoredOutput RESTORED_FLOAT64 =
+    ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT64;
+  static inline bool RestoredOutput_IsValid(int value) {
+    return ReconTaskParameterPB_RestoredOutput_IsValid(value);
+  }
+  static constexpr RestoredOutput RestoredOutput_MIN =
+    ReconTaskParameterPB_RestoredOutput_RestoredOutput_MIN;
+  static constexpr RestoredOutput RestoredOutput_MAX =
+    ReconTaskParameterPB_RestoredOutput_RestoredOutput_MAX;
+  static constexpr int RestoredOutput_ARRAYSIZE =
+    ReconTaskParameterPB_RestoredOutput_RestoredOutput_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  RestoredOutput_descriptor() {
+    return ReconTaskParameterPB_RestoredOutput_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& RestoredOutput_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, RestoredOutput>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function RestoredOutput_Name.");
+    return ReconTaskParameterPB_RestoredOutput_Name(enum_t_value);
+  }
+  static inline bool RestoredOutput_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      RestoredOutput* value) {
+    return ReconTaskParameterPB_RestoredOutput_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
@@ -431,7 +531,13 @@ class ReconTaskParameterPB final :
     kNumSlicesFieldNumber = 22,
     kNumResultsFieldNumber = 23,
     kResolutionFieldNumber = 31,
+    kReconstructVolumeFieldNumber = 32,
+    kSliceBeginFieldNumber = 33,
+    kModelPrecisionFieldNumber = 36,
     kFileDataTypeFieldNumber = 17,
+    kSliceEndFieldNumber = 34,
+    kSnapshotIntervalFieldNumber = 35,
+    kRestoredOutputFieldNumber = 37,
   };
   // repeated double sinogram_data = 24;
   int sinogram_data_size() const;
@@ -890,6 +996,45 @@ class ReconTaskParameterPB final :
   void _internal_set_resolution(int32_t value);
   public:
 
+  // optional bool reconstruct_volume = 32;
+  bool has_reconstruct_volume() const;
+  private:
+  bool _internal_has_reconstruct_volume() const;
+  public:
+  void clear_reconstruct_volume();
+  bool reconstruct_volume() const;
+  void set_reconstruct_volume(bool value);
+  private:
+  bool _internal_reconstruct_volume() const;
+  void _internal_set_reconstruct_volume(bool value);
+  public:
+
+  // optional int32 slice_begin = 33 [default = 0];
+  bool has_slice_begin() const;
+  private:
+  bool _internal_has_slice_begin() const;
+  public:
+  void clear_slice_begin();
+  int32_t slice_begin() const;
+  void set_slice_begin(int32_t value);
+  private:
+  int32_t _internal_slice_begin() const;
+  void _internal_set_slice_begin(int32_t value);
+  public:
+
+  // optional .recontaskparameter_pb.ReconTaskParameterPB.ModelPrecision model_precision = 36 [default = MODEL_FP32];
+  bool has_model_precision() const;
+  private:
+  bool _internal_has_model_precision() const;
+  public:
+  void clear_model_precision();
+  ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision model_precision() const;
+  void set_model_precision(::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision value);
+  private:
+  ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision _internal_model_precision() const;
+  void _internal_set_model_precision(::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision value);
+  public:
+
   // required .recontaskparameter_pb.ReconTaskParameterPB.FileDataType file_data_type = 17;
   bool has_file_data_type() const;
   private:
@@ -903,6 +1048,45 @@ class ReconTaskParameterPB final :
   void _internal_set_file_data_type(::recontaskparameter_pb::ReconTaskParameterPB_FileDataType value);
   public:
 
+  // optional int32 slice_end = 34 [default = -1];
+  bool has_slice_end() const;
+  private:
+  bool _internal_has_slice_end() const;
+  public:
+  void clear_slice_end();
+  int32_t slice_end() const;
+  void set_slice_end(int32_t value);
+  private:
+  int32_t _internal_slice_end() const;
+  void _internal_set_slice_end(int32_t value);
+  public:
+
+  // optional int32 snapshot_interval = 35 [default = 5];
+  bool has_snapshot_interval() const;
+  private:
+  bool _internal_has_snapshot_interval() const;
+  public:
+  void clear_snapshot_interval();
+  int32_t snapshot_interval() const;
+  void set_snapshot_interval(int32_t value);
+  private:
+  int32_t _internal_snapshot_interval() const;
+  void _internal_set_snapshot_interval(int32_t value);
+  public:
+
+  // optional .recontaskparameter_pb.ReconTaskParameterPB.RestoredOutput restored_output = 37 [default = RESTORED_FLOAT64];
+  bool has_restored_output() const;
+  private:
+  bool _internal_has_restored_output() const;
+  public:
+  void clear_restored_output();
+  ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput restored_output() const;
+  void set_restored_output(::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput value);
+  private:
+  ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput _internal_restored_output() const;
+  void _internal_set_restored_output(::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput value);
+  public:
+
   // @@protoc_insertion_point(class_scope:recontaskparameter_pb.ReconTaskParameterPB)
  private:
   class _Internal;
@@ -913,39 +1097,48 @@ class ReconTaskParameterPB final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > sinogram_data_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > restored_sinogram_data_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > reconstructed_tomographs_data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_sysmat_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_sinogdram_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_scatter_map_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_mu_map_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr output_dir_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_model_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sinogram_info_;
-  int32_t num_iters_;
-  int32_t num_dual_iters_;
-  double gamma_;
-  double lambda_;
-  double coeff_scatter_;
-  int iterator_;
-  int file_format_;
-  int32_t num_input_images_;
-  bool use_nn_;
-  bool use_scatter_map_;
-  bool done_;
-  bool loaded_;
-  int32_t index_sinogram_;
-  int32_t index_projection_;
-  int32_t num_detectors_;
-  int32_t num_angles_;
-  int32_t num_slices_;
-  int32_t num_results_;
-  int32_t resolution_;
-  int file_data_type_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<2> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > sinogram_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > restored_sinogram_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > reconstructed_tomographs_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_sysmat_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_sinogdram_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_scatter_map_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_mu_map_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr output_dir_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_model_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sinogram_info_;
+    int32_t num_iters_;
+    int32_t num_dual_iters_;
+    double gamma_;
+    double lambda_;
+    double coeff_scatter_;
+    int iterator_;
+    int file_format_;
+    int32_t num_input_images_;
+    bool use_nn_;
+    bool use_scatter_map_;
+    bool done_;
+    bool loaded_;
+    int32_t index_sinogram_;
+    int32_t index_projection_;
+    int32_t num_detectors_;
+    int32_t num_angles_;
+    int32_t num_slices_;
+    int32_t num_results_;
+    int32_t resolution_;
+    bool reconstruct_volume_;
+    int32_t slice_begin_;
+    int model_precision_;
+    int file_data_type_;
+    int32_t slice_end_;
+    int32_t snapshot_interval_;
+    int restored_output_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_recontaskparameter_2eproto;
 };
 // ===================================================================
@@ -961,15 +1154,15 @@ class ReconTaskParameterPB final :
 
 // required string task_name = 1;
 inline bool ReconTaskParameterPB::_internal_has_task_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_task_name() const {
   return _internal_has_task_name();
 }
 inline void ReconTaskParameterPB::clear_task_name() {
-  task_name_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.task_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ReconTaskParameterPB::task_name() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.task_name)
@@ -978,8 +1171,8 @@ inline const std::string& ReconTaskParameterPB::task_name() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_task_name(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000001u;
- task_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.task_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.task_name)
 }
 inline std::string* ReconTaskParameterPB::mutable_task_name() {
@@ -988,41 +1181,40 @@ inline std::string* ReconTaskParameterPB::mutable_task_name() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_task_name() const {
-  return task_name_.Get();
+  return _impl_.task_name_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_task_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  task_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.task_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_task_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return task_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.task_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_task_name() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.task_name)
   if (!_internal_has_task_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  auto* p = task_name_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.task_name_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (task_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    task_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.task_name_.IsDefault()) {
+    _impl_.task_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_task_name(std::string* task_name) {
   if (task_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  task_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_name,
-      GetArenaForAllocation());
+  _impl_.task_name_.SetAllocated(task_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (task_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    task_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.task_name_.IsDefault()) {
+    _impl_.task_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.task_name)
@@ -1030,15 +1222,15 @@ inline void ReconTaskParameterPB::set_allocated_task_name(std::string* task_name
 
 // required string path_sysmat = 2;
 inline bool ReconTaskParameterPB::_internal_has_path_sysmat() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_path_sysmat() const {
   return _internal_has_path_sysmat();
 }
 inline void ReconTaskParameterPB::clear_path_sysmat() {
-  path_sysmat_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.path_sysmat_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& ReconTaskParameterPB::path_sysmat() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.path_sysmat)
@@ -1047,8 +1239,8 @@ inline const std::string& ReconTaskParameterPB::path_sysmat() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_path_sysmat(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000002u;
- path_sysmat_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.path_sysmat_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.path_sysmat)
 }
 inline std::string* ReconTaskParameterPB::mutable_path_sysmat() {
@@ -1057,41 +1249,40 @@ inline std::string* ReconTaskParameterPB::mutable_path_sysmat() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_path_sysmat() const {
-  return path_sysmat_.Get();
+  return _impl_.path_sysmat_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_path_sysmat(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  path_sysmat_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.path_sysmat_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_path_sysmat() {
-  _has_bits_[0] |= 0x00000002u;
-  return path_sysmat_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.path_sysmat_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_path_sysmat() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.path_sysmat)
   if (!_internal_has_path_sysmat()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  auto* p = path_sysmat_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.path_sysmat_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_sysmat_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_sysmat_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_sysmat_.IsDefault()) {
+    _impl_.path_sysmat_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_path_sysmat(std::string* path_sysmat) {
   if (path_sysmat != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  path_sysmat_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path_sysmat,
-      GetArenaForAllocation());
+  _impl_.path_sysmat_.SetAllocated(path_sysmat, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_sysmat_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_sysmat_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_sysmat_.IsDefault()) {
+    _impl_.path_sysmat_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.path_sysmat)
@@ -1099,15 +1290,15 @@ inline void ReconTaskParameterPB::set_allocated_path_sysmat(std::string* path_sy
 
 // required string path_sinogdram = 3;
 inline bool ReconTaskParameterPB::_internal_has_path_sinogdram() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_path_sinogdram() const {
   return _internal_has_path_sinogdram();
 }
 inline void ReconTaskParameterPB::clear_path_sinogdram() {
-  path_sinogdram_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.path_sinogdram_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& ReconTaskParameterPB::path_sinogdram() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.path_sinogdram)
@@ -1116,8 +1307,8 @@ inline const std::string& ReconTaskParameterPB::path_sinogdram() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_path_sinogdram(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000004u;
- path_sinogdram_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.path_sinogdram_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.path_sinogdram)
 }
 inline std::string* ReconTaskParameterPB::mutable_path_sinogdram() {
@@ -1126,41 +1317,40 @@ inline std::string* ReconTaskParameterPB::mutable_path_sinogdram() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_path_sinogdram() const {
-  return path_sinogdram_.Get();
+  return _impl_.path_sinogdram_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_path_sinogdram(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  path_sinogdram_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.path_sinogdram_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_path_sinogdram() {
-  _has_bits_[0] |= 0x00000004u;
-  return path_sinogdram_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.path_sinogdram_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_path_sinogdram() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.path_sinogdram)
   if (!_internal_has_path_sinogdram()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  auto* p = path_sinogdram_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.path_sinogdram_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_sinogdram_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_sinogdram_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_sinogdram_.IsDefault()) {
+    _impl_.path_sinogdram_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_path_sinogdram(std::string* path_sinogdram) {
   if (path_sinogdram != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  path_sinogdram_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path_sinogdram,
-      GetArenaForAllocation());
+  _impl_.path_sinogdram_.SetAllocated(path_sinogdram, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_sinogdram_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_sinogdram_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_sinogdram_.IsDefault()) {
+    _impl_.path_sinogdram_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.path_sinogdram)
@@ -1168,15 +1358,15 @@ inline void ReconTaskParameterPB::set_allocated_path_sinogdram(std::string* path
 
 // optional string path_scatter_map = 4;
 inline bool ReconTaskParameterPB::_internal_has_path_scatter_map() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_path_scatter_map() const {
   return _internal_has_path_scatter_map();
 }
 inline void ReconTaskParameterPB::clear_path_scatter_map() {
-  path_scatter_map_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.path_scatter_map_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const std::string& ReconTaskParameterPB::path_scatter_map() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.path_scatter_map)
@@ -1185,8 +1375,8 @@ inline const std::string& ReconTaskParameterPB::path_scatter_map() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_path_scatter_map(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000008u;
- path_scatter_map_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.path_scatter_map_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.path_scatter_map)
 }
 inline std::string* ReconTaskParameterPB::mutable_path_scatter_map() {
@@ -1195,41 +1385,40 @@ inline std::string* ReconTaskParameterPB::mutable_path_scatter_map() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_path_scatter_map() const {
-  return path_scatter_map_.Get();
+  return _impl_.path_scatter_map_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_path_scatter_map(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  path_scatter_map_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.path_scatter_map_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_path_scatter_map() {
-  _has_bits_[0] |= 0x00000008u;
-  return path_scatter_map_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.path_scatter_map_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_path_scatter_map() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.path_scatter_map)
   if (!_internal_has_path_scatter_map()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000008u;
-  auto* p = path_scatter_map_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.path_scatter_map_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_scatter_map_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_scatter_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_scatter_map_.IsDefault()) {
+    _impl_.path_scatter_map_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_path_scatter_map(std::string* path_scatter_map) {
   if (path_scatter_map != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  path_scatter_map_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path_scatter_map,
-      GetArenaForAllocation());
+  _impl_.path_scatter_map_.SetAllocated(path_scatter_map, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_scatter_map_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_scatter_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_scatter_map_.IsDefault()) {
+    _impl_.path_scatter_map_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.path_scatter_map)
@@ -1237,15 +1426,15 @@ inline void ReconTaskParameterPB::set_allocated_path_scatter_map(std::string* pa
 
 // optional string path_mu_map = 5;
 inline bool ReconTaskParameterPB::_internal_has_path_mu_map() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_path_mu_map() const {
   return _internal_has_path_mu_map();
 }
 inline void ReconTaskParameterPB::clear_path_mu_map() {
-  path_mu_map_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.path_mu_map_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const std::string& ReconTaskParameterPB::path_mu_map() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.path_mu_map)
@@ -1254,8 +1443,8 @@ inline const std::string& ReconTaskParameterPB::path_mu_map() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_path_mu_map(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000010u;
- path_mu_map_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.path_mu_map_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.path_mu_map)
 }
 inline std::string* ReconTaskParameterPB::mutable_path_mu_map() {
@@ -1264,41 +1453,40 @@ inline std::string* ReconTaskParameterPB::mutable_path_mu_map() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_path_mu_map() const {
-  return path_mu_map_.Get();
+  return _impl_.path_mu_map_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_path_mu_map(const std::string& value) {
-  _has_bits_[0] |= 0x00000010u;
-  path_mu_map_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.path_mu_map_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_path_mu_map() {
-  _has_bits_[0] |= 0x00000010u;
-  return path_mu_map_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.path_mu_map_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_path_mu_map() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.path_mu_map)
   if (!_internal_has_path_mu_map()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000010u;
-  auto* p = path_mu_map_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.path_mu_map_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_mu_map_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_mu_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_mu_map_.IsDefault()) {
+    _impl_.path_mu_map_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_path_mu_map(std::string* path_mu_map) {
   if (path_mu_map != nullptr) {
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  path_mu_map_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path_mu_map,
-      GetArenaForAllocation());
+  _impl_.path_mu_map_.SetAllocated(path_mu_map, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_mu_map_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_mu_map_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_mu_map_.IsDefault()) {
+    _impl_.path_mu_map_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.path_mu_map)
@@ -1306,26 +1494,26 @@ inline void ReconTaskParameterPB::set_allocated_path_mu_map(std::string* path_mu
 
 // required bool use_nn = 6;
 inline bool ReconTaskParameterPB::_internal_has_use_nn() const {
-  bool value = (_has_bits_[0] & 0x00010000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_use_nn() const {
   return _internal_has_use_nn();
 }
 inline void ReconTaskParameterPB::clear_use_nn() {
-  use_nn_ = false;
-  _has_bits_[0] &= ~0x00010000u;
+  _impl_.use_nn_ = false;
+  _impl_._has_bits_[0] &= ~0x00010000u;
 }
 inline bool ReconTaskParameterPB::_internal_use_nn() const {
-  return use_nn_;
+  return _impl_.use_nn_;
 }
 inline bool ReconTaskParameterPB::use_nn() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.use_nn)
   return _internal_use_nn();
 }
 inline void ReconTaskParameterPB::_internal_set_use_nn(bool value) {
-  _has_bits_[0] |= 0x00010000u;
-  use_nn_ = value;
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.use_nn_ = value;
 }
 inline void ReconTaskParameterPB::set_use_nn(bool value) {
   _internal_set_use_nn(value);
@@ -1334,26 +1522,26 @@ inline void ReconTaskParameterPB::set_use_nn(bool value) {
 
 // required bool use_scatter_map = 7;
 inline bool ReconTaskParameterPB::_internal_has_use_scatter_map() const {
-  bool value = (_has_bits_[0] & 0x00020000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_use_scatter_map() const {
   return _internal_has_use_scatter_map();
 }
 inline void ReconTaskParameterPB::clear_use_scatter_map() {
-  use_scatter_map_ = false;
-  _has_bits_[0] &= ~0x00020000u;
+  _impl_.use_scatter_map_ = false;
+  _impl_._has_bits_[0] &= ~0x00020000u;
 }
 inline bool ReconTaskParameterPB::_internal_use_scatter_map() const {
-  return use_scatter_map_;
+  return _impl_.use_scatter_map_;
 }
 inline bool ReconTaskParameterPB::use_scatter_map() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.use_scatter_map)
   return _internal_use_scatter_map();
 }
 inline void ReconTaskParameterPB::_internal_set_use_scatter_map(bool value) {
-  _has_bits_[0] |= 0x00020000u;
-  use_scatter_map_ = value;
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.use_scatter_map_ = value;
 }
 inline void ReconTaskParameterPB::set_use_scatter_map(bool value) {
   _internal_set_use_scatter_map(value);
@@ -1362,26 +1550,26 @@ inline void ReconTaskParameterPB::set_use_scatter_map(bool value) {
 
 // required int32 num_iters = 8;
 inline bool ReconTaskParameterPB::_internal_has_num_iters() const {
-  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_iters() const {
   return _internal_has_num_iters();
 }
 inline void ReconTaskParameterPB::clear_num_iters() {
-  num_iters_ = 0;
-  _has_bits_[0] &= ~0x00000100u;
+  _impl_.num_iters_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_iters() const {
-  return num_iters_;
+  return _impl_.num_iters_;
 }
 inline int32_t ReconTaskParameterPB::num_iters() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_iters)
   return _internal_num_iters();
 }
 inline void ReconTaskParameterPB::_internal_set_num_iters(int32_t value) {
-  _has_bits_[0] |= 0x00000100u;
-  num_iters_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.num_iters_ = value;
 }
 inline void ReconTaskParameterPB::set_num_iters(int32_t value) {
   _internal_set_num_iters(value);
@@ -1390,26 +1578,26 @@ inline void ReconTaskParameterPB::set_num_iters(int32_t value) {
 
 // required int32 num_dual_iters = 9;
 inline bool ReconTaskParameterPB::_internal_has_num_dual_iters() const {
-  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_dual_iters() const {
   return _internal_has_num_dual_iters();
 }
 inline void ReconTaskParameterPB::clear_num_dual_iters() {
-  num_dual_iters_ = 0;
-  _has_bits_[0] &= ~0x00000200u;
+  _impl_.num_dual_iters_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_dual_iters() const {
-  return num_dual_iters_;
+  return _impl_.num_dual_iters_;
 }
 inline int32_t ReconTaskParameterPB::num_dual_iters() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_dual_iters)
   return _internal_num_dual_iters();
 }
 inline void ReconTaskParameterPB::_internal_set_num_dual_iters(int32_t value) {
-  _has_bits_[0] |= 0x00000200u;
-  num_dual_iters_ = value;
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.num_dual_iters_ = value;
 }
 inline void ReconTaskParameterPB::set_num_dual_iters(int32_t value) {
   _internal_set_num_dual_iters(value);
@@ -1418,26 +1606,26 @@ inline void ReconTaskParameterPB::set_num_dual_iters(int32_t value) {
 
 // required double gamma = 10;
 inline bool ReconTaskParameterPB::_internal_has_gamma() const {
-  bool value = (_has_bits_[0] & 0x00000400u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_gamma() const {
   return _internal_has_gamma();
 }
 inline void ReconTaskParameterPB::clear_gamma() {
-  gamma_ = 0;
-  _has_bits_[0] &= ~0x00000400u;
+  _impl_.gamma_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
 inline double ReconTaskParameterPB::_internal_gamma() const {
-  return gamma_;
+  return _impl_.gamma_;
 }
 inline double ReconTaskParameterPB::gamma() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.gamma)
   return _internal_gamma();
 }
 inline void ReconTaskParameterPB::_internal_set_gamma(double value) {
-  _has_bits_[0] |= 0x00000400u;
-  gamma_ = value;
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.gamma_ = value;
 }
 inline void ReconTaskParameterPB::set_gamma(double value) {
   _internal_set_gamma(value);
@@ -1446,26 +1634,26 @@ inline void ReconTaskParameterPB::set_gamma(double value) {
 
 // required double lambda = 11;
 inline bool ReconTaskParameterPB::_internal_has_lambda() const {
-  bool value = (_has_bits_[0] & 0x00000800u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_lambda() const {
   return _internal_has_lambda();
 }
 inline void ReconTaskParameterPB::clear_lambda() {
-  lambda_ = 0;
-  _has_bits_[0] &= ~0x00000800u;
+  _impl_.lambda_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
 }
 inline double ReconTaskParameterPB::_internal_lambda() const {
-  return lambda_;
+  return _impl_.lambda_;
 }
 inline double ReconTaskParameterPB::lambda() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.lambda)
   return _internal_lambda();
 }
 inline void ReconTaskParameterPB::_internal_set_lambda(double value) {
-  _has_bits_[0] |= 0x00000800u;
-  lambda_ = value;
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.lambda_ = value;
 }
 inline void ReconTaskParameterPB::set_lambda(double value) {
   _internal_set_lambda(value);
@@ -1474,26 +1662,26 @@ inline void ReconTaskParameterPB::set_lambda(double value) {
 
 // optional double coeff_scatter = 12;
 inline bool ReconTaskParameterPB::_internal_has_coeff_scatter() const {
-  bool value = (_has_bits_[0] & 0x00001000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_coeff_scatter() const {
   return _internal_has_coeff_scatter();
 }
 inline void ReconTaskParameterPB::clear_coeff_scatter() {
-  coeff_scatter_ = 0;
-  _has_bits_[0] &= ~0x00001000u;
+  _impl_.coeff_scatter_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
 }
 inline double ReconTaskParameterPB::_internal_coeff_scatter() const {
-  return coeff_scatter_;
+  return _impl_.coeff_scatter_;
 }
 inline double ReconTaskParameterPB::coeff_scatter() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.coeff_scatter)
   return _internal_coeff_scatter();
 }
 inline void ReconTaskParameterPB::_internal_set_coeff_scatter(double value) {
-  _has_bits_[0] |= 0x00001000u;
-  coeff_scatter_ = value;
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.coeff_scatter_ = value;
 }
 inline void ReconTaskParameterPB::set_coeff_scatter(double value) {
   _internal_set_coeff_scatter(value);
@@ -1502,15 +1690,15 @@ inline void ReconTaskParameterPB::set_coeff_scatter(double value) {
 
 // required string output_dir = 13;
 inline bool ReconTaskParameterPB::_internal_has_output_dir() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_output_dir() const {
   return _internal_has_output_dir();
 }
 inline void ReconTaskParameterPB::clear_output_dir() {
-  output_dir_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.output_dir_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline const std::string& ReconTaskParameterPB::output_dir() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.output_dir)
@@ -1519,8 +1707,8 @@ inline const std::string& ReconTaskParameterPB::output_dir() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_output_dir(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000020u;
- output_dir_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000020u;
+ _impl_.output_dir_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.output_dir)
 }
 inline std::string* ReconTaskParameterPB::mutable_output_dir() {
@@ -1529,41 +1717,40 @@ inline std::string* ReconTaskParameterPB::mutable_output_dir() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_output_dir() const {
-  return output_dir_.Get();
+  return _impl_.output_dir_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_output_dir(const std::string& value) {
-  _has_bits_[0] |= 0x00000020u;
-  output_dir_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.output_dir_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_output_dir() {
-  _has_bits_[0] |= 0x00000020u;
-  return output_dir_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000020u;
+  return _impl_.output_dir_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_output_dir() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.output_dir)
   if (!_internal_has_output_dir()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000020u;
-  auto* p = output_dir_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  auto* p = _impl_.output_dir_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (output_dir_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    output_dir_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.output_dir_.IsDefault()) {
+    _impl_.output_dir_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_output_dir(std::string* output_dir) {
   if (output_dir != nullptr) {
-    _has_bits_[0] |= 0x00000020u;
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
-  output_dir_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), output_dir,
-      GetArenaForAllocation());
+  _impl_.output_dir_.SetAllocated(output_dir, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (output_dir_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    output_dir_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.output_dir_.IsDefault()) {
+    _impl_.output_dir_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.output_dir)
@@ -1571,18 +1758,18 @@ inline void ReconTaskParameterPB::set_allocated_output_dir(std::string* output_d
 
 // required .recontaskparameter_pb.ReconTaskParameterPB.IteratorType iterator = 14;
 inline bool ReconTaskParameterPB::_internal_has_iterator() const {
-  bool value = (_has_bits_[0] & 0x00002000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_iterator() const {
   return _internal_has_iterator();
 }
 inline void ReconTaskParameterPB::clear_iterator() {
-  iterator_ = 0;
-  _has_bits_[0] &= ~0x00002000u;
+  _impl_.iterator_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
 }
 inline ::recontaskparameter_pb::ReconTaskParameterPB_IteratorType ReconTaskParameterPB::_internal_iterator() const {
-  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_IteratorType >(iterator_);
+  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_IteratorType >(_impl_.iterator_);
 }
 inline ::recontaskparameter_pb::ReconTaskParameterPB_IteratorType ReconTaskParameterPB::iterator() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.iterator)
@@ -1590,8 +1777,8 @@ inline ::recontaskparameter_pb::ReconTaskParameterPB_IteratorType ReconTaskParam
 }
 inline void ReconTaskParameterPB::_internal_set_iterator(::recontaskparameter_pb::ReconTaskParameterPB_IteratorType value) {
   assert(::recontaskparameter_pb::ReconTaskParameterPB_IteratorType_IsValid(value));
-  _has_bits_[0] |= 0x00002000u;
-  iterator_ = value;
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.iterator_ = value;
 }
 inline void ReconTaskParameterPB::set_iterator(::recontaskparameter_pb::ReconTaskParameterPB_IteratorType value) {
   _internal_set_iterator(value);
@@ -1600,18 +1787,18 @@ inline void ReconTaskParameterPB::set_iterator(::recontaskparameter_pb::ReconTas
 
 // required .recontaskparameter_pb.ReconTaskParameterPB.FileFormat file_format = 15;
 inline bool ReconTaskParameterPB::_internal_has_file_format() const {
-  bool value = (_has_bits_[0] & 0x00004000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_file_format() const {
   return _internal_has_file_format();
 }
 inline void ReconTaskParameterPB::clear_file_format() {
-  file_format_ = 0;
-  _has_bits_[0] &= ~0x00004000u;
+  _impl_.file_format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
 }
 inline ::recontaskparameter_pb::ReconTaskParameterPB_FileFormat ReconTaskParameterPB::_internal_file_format() const {
-  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_FileFormat >(file_format_);
+  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_FileFormat >(_impl_.file_format_);
 }
 inline ::recontaskparameter_pb::ReconTaskParameterPB_FileFormat ReconTaskParameterPB::file_format() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.file_format)
@@ -1619,8 +1806,8 @@ inline ::recontaskparameter_pb::ReconTaskParameterPB_FileFormat ReconTaskParamet
 }
 inline void ReconTaskParameterPB::_internal_set_file_format(::recontaskparameter_pb::ReconTaskParameterPB_FileFormat value) {
   assert(::recontaskparameter_pb::ReconTaskParameterPB_FileFormat_IsValid(value));
-  _has_bits_[0] |= 0x00004000u;
-  file_format_ = value;
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.file_format_ = value;
 }
 inline void ReconTaskParameterPB::set_file_format(::recontaskparameter_pb::ReconTaskParameterPB_FileFormat value) {
   _internal_set_file_format(value);
@@ -1629,26 +1816,26 @@ inline void ReconTaskParameterPB::set_file_format(::recontaskparameter_pb::Recon
 
 // required int32 num_input_images = 16;
 inline bool ReconTaskParameterPB::_internal_has_num_input_images() const {
-  bool value = (_has_bits_[0] & 0x00008000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_input_images() const {
   return _internal_has_num_input_images();
 }
 inline void ReconTaskParameterPB::clear_num_input_images() {
-  num_input_images_ = 0;
-  _has_bits_[0] &= ~0x00008000u;
+  _impl_.num_input_images_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_input_images() const {
-  return num_input_images_;
+  return _impl_.num_input_images_;
 }
 inline int32_t ReconTaskParameterPB::num_input_images() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_input_images)
   return _internal_num_input_images();
 }
 inline void ReconTaskParameterPB::_internal_set_num_input_images(int32_t value) {
-  _has_bits_[0] |= 0x00008000u;
-  num_input_images_ = value;
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.num_input_images_ = value;
 }
 inline void ReconTaskParameterPB::set_num_input_images(int32_t value) {
   _internal_set_num_input_images(value);
@@ -1657,18 +1844,18 @@ inline void ReconTaskParameterPB::set_num_input_images(int32_t value) {
 
 // required .recontaskparameter_pb.ReconTaskParameterPB.FileDataType file_data_type = 17;
 inline bool ReconTaskParameterPB::_internal_has_file_data_type() const {
-  bool value = (_has_bits_[0] & 0x08000000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x40000000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_file_data_type() const {
   return _internal_has_file_data_type();
 }
 inline void ReconTaskParameterPB::clear_file_data_type() {
-  file_data_type_ = 1;
-  _has_bits_[0] &= ~0x08000000u;
+  _impl_.file_data_type_ = 1;
+  _impl_._has_bits_[0] &= ~0x40000000u;
 }
 inline ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType ReconTaskParameterPB::_internal_file_data_type() const {
-  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType >(file_data_type_);
+  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType >(_impl_.file_data_type_);
 }
 inline ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType ReconTaskParameterPB::file_data_type() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.file_data_type)
@@ -1676,8 +1863,8 @@ inline ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType ReconTaskParam
 }
 inline void ReconTaskParameterPB::_internal_set_file_data_type(::recontaskparameter_pb::ReconTaskParameterPB_FileDataType value) {
   assert(::recontaskparameter_pb::ReconTaskParameterPB_FileDataType_IsValid(value));
-  _has_bits_[0] |= 0x08000000u;
-  file_data_type_ = value;
+  _impl_._has_bits_[0] |= 0x40000000u;
+  _impl_.file_data_type_ = value;
 }
 inline void ReconTaskParameterPB::set_file_data_type(::recontaskparameter_pb::ReconTaskParameterPB_FileDataType value) {
   _internal_set_file_data_type(value);
@@ -1686,26 +1873,26 @@ inline void ReconTaskParameterPB::set_file_data_type(::recontaskparameter_pb::Re
 
 // required int32 index_sinogram = 18;
 inline bool ReconTaskParameterPB::_internal_has_index_sinogram() const {
-  bool value = (_has_bits_[0] & 0x00100000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_index_sinogram() const {
   return _internal_has_index_sinogram();
 }
 inline void ReconTaskParameterPB::clear_index_sinogram() {
-  index_sinogram_ = 0;
-  _has_bits_[0] &= ~0x00100000u;
+  _impl_.index_sinogram_ = 0;
+  _impl_._has_bits_[0] &= ~0x00100000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_index_sinogram() const {
-  return index_sinogram_;
+  return _impl_.index_sinogram_;
 }
 inline int32_t ReconTaskParameterPB::index_sinogram() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.index_sinogram)
   return _internal_index_sinogram();
 }
 inline void ReconTaskParameterPB::_internal_set_index_sinogram(int32_t value) {
-  _has_bits_[0] |= 0x00100000u;
-  index_sinogram_ = value;
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.index_sinogram_ = value;
 }
 inline void ReconTaskParameterPB::set_index_sinogram(int32_t value) {
   _internal_set_index_sinogram(value);
@@ -1714,26 +1901,26 @@ inline void ReconTaskParameterPB::set_index_sinogram(int32_t value) {
 
 // required int32 index_projection = 19;
 inline bool ReconTaskParameterPB::_internal_has_index_projection() const {
-  bool value = (_has_bits_[0] & 0x00200000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_index_projection() const {
   return _internal_has_index_projection();
 }
 inline void ReconTaskParameterPB::clear_index_projection() {
-  index_projection_ = 0;
-  _has_bits_[0] &= ~0x00200000u;
+  _impl_.index_projection_ = 0;
+  _impl_._has_bits_[0] &= ~0x00200000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_index_projection() const {
-  return index_projection_;
+  return _impl_.index_projection_;
 }
 inline int32_t ReconTaskParameterPB::index_projection() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.index_projection)
   return _internal_index_projection();
 }
 inline void ReconTaskParameterPB::_internal_set_index_projection(int32_t value) {
-  _has_bits_[0] |= 0x00200000u;
-  index_projection_ = value;
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.index_projection_ = value;
 }
 inline void ReconTaskParameterPB::set_index_projection(int32_t value) {
   _internal_set_index_projection(value);
@@ -1742,26 +1929,26 @@ inline void ReconTaskParameterPB::set_index_projection(int32_t value) {
 
 // required int32 num_detectors = 20;
 inline bool ReconTaskParameterPB::_internal_has_num_detectors() const {
-  bool value = (_has_bits_[0] & 0x00400000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_detectors() const {
   return _internal_has_num_detectors();
 }
 inline void ReconTaskParameterPB::clear_num_detectors() {
-  num_detectors_ = 0;
-  _has_bits_[0] &= ~0x00400000u;
+  _impl_.num_detectors_ = 0;
+  _impl_._has_bits_[0] &= ~0x00400000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_detectors() const {
-  return num_detectors_;
+  return _impl_.num_detectors_;
 }
 inline int32_t ReconTaskParameterPB::num_detectors() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_detectors)
   return _internal_num_detectors();
 }
 inline void ReconTaskParameterPB::_internal_set_num_detectors(int32_t value) {
-  _has_bits_[0] |= 0x00400000u;
-  num_detectors_ = value;
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.num_detectors_ = value;
 }
 inline void ReconTaskParameterPB::set_num_detectors(int32_t value) {
   _internal_set_num_detectors(value);
@@ -1770,26 +1957,26 @@ inline void ReconTaskParameterPB::set_num_detectors(int32_t value) {
 
 // required int32 num_angles = 21;
 inline bool ReconTaskParameterPB::_internal_has_num_angles() const {
-  bool value = (_has_bits_[0] & 0x00800000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_angles() const {
   return _internal_has_num_angles();
 }
 inline void ReconTaskParameterPB::clear_num_angles() {
-  num_angles_ = 0;
-  _has_bits_[0] &= ~0x00800000u;
+  _impl_.num_angles_ = 0;
+  _impl_._has_bits_[0] &= ~0x00800000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_angles() const {
-  return num_angles_;
+  return _impl_.num_angles_;
 }
 inline int32_t ReconTaskParameterPB::num_angles() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_angles)
   return _internal_num_angles();
 }
 inline void ReconTaskParameterPB::_internal_set_num_angles(int32_t value) {
-  _has_bits_[0] |= 0x00800000u;
-  num_angles_ = value;
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.num_angles_ = value;
 }
 inline void ReconTaskParameterPB::set_num_angles(int32_t value) {
   _internal_set_num_angles(value);
@@ -1798,26 +1985,26 @@ inline void ReconTaskParameterPB::set_num_angles(int32_t value) {
 
 // required int32 num_slices = 22;
 inline bool ReconTaskParameterPB::_internal_has_num_slices() const {
-  bool value = (_has_bits_[0] & 0x01000000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_slices() const {
   return _internal_has_num_slices();
 }
 inline void ReconTaskParameterPB::clear_num_slices() {
-  num_slices_ = 0;
-  _has_bits_[0] &= ~0x01000000u;
+  _impl_.num_slices_ = 0;
+  _impl_._has_bits_[0] &= ~0x01000000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_slices() const {
-  return num_slices_;
+  return _impl_.num_slices_;
 }
 inline int32_t ReconTaskParameterPB::num_slices() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_slices)
   return _internal_num_slices();
 }
 inline void ReconTaskParameterPB::_internal_set_num_slices(int32_t value) {
-  _has_bits_[0] |= 0x01000000u;
-  num_slices_ = value;
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.num_slices_ = value;
 }
 inline void ReconTaskParameterPB::set_num_slices(int32_t value) {
   _internal_set_num_slices(value);
@@ -1826,26 +2013,26 @@ inline void ReconTaskParameterPB::set_num_slices(int32_t value) {
 
 // required int32 num_results = 23;
 inline bool ReconTaskParameterPB::_internal_has_num_results() const {
-  bool value = (_has_bits_[0] & 0x02000000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_num_results() const {
   return _internal_has_num_results();
 }
 inline void ReconTaskParameterPB::clear_num_results() {
-  num_results_ = 0;
-  _has_bits_[0] &= ~0x02000000u;
+  _impl_.num_results_ = 0;
+  _impl_._has_bits_[0] &= ~0x02000000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_num_results() const {
-  return num_results_;
+  return _impl_.num_results_;
 }
 inline int32_t ReconTaskParameterPB::num_results() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.num_results)
   return _internal_num_results();
 }
 inline void ReconTaskParameterPB::_internal_set_num_results(int32_t value) {
-  _has_bits_[0] |= 0x02000000u;
-  num_results_ = value;
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.num_results_ = value;
 }
 inline void ReconTaskParameterPB::set_num_results(int32_t value) {
   _internal_set_num_results(value);
@@ -1854,27 +2041,27 @@ inline void ReconTaskParameterPB::set_num_results(int32_t value) {
 
 // repeated double sinogram_data = 24;
 inline int ReconTaskParameterPB::_internal_sinogram_data_size() const {
-  return sinogram_data_.size();
+  return _impl_.sinogram_data_.size();
 }
 inline int ReconTaskParameterPB::sinogram_data_size() const {
   return _internal_sinogram_data_size();
 }
 inline void ReconTaskParameterPB::clear_sinogram_data() {
-  sinogram_data_.Clear();
+  _impl_.sinogram_data_.Clear();
 }
 inline double ReconTaskParameterPB::_internal_sinogram_data(int index) const {
-  return sinogram_data_.Get(index);
+  return _impl_.sinogram_data_.Get(index);
 }
 inline double ReconTaskParameterPB::sinogram_data(int index) const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.sinogram_data)
   return _internal_sinogram_data(index);
 }
 inline void ReconTaskParameterPB::set_sinogram_data(int index, double value) {
-  sinogram_data_.Set(index, value);
+  _impl_.sinogram_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.sinogram_data)
 }
 inline void ReconTaskParameterPB::_internal_add_sinogram_data(double value) {
-  sinogram_data_.Add(value);
+  _impl_.sinogram_data_.Add(value);
 }
 inline void ReconTaskParameterPB::add_sinogram_data(double value) {
   _internal_add_sinogram_data(value);
@@ -1882,7 +2069,7 @@ inline void ReconTaskParameterPB::add_sinogram_data(double value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 ReconTaskParameterPB::_internal_sinogram_data() const {
-  return sinogram_data_;
+  return _impl_.sinogram_data_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 ReconTaskParameterPB::sinogram_data() const {
@@ -1891,7 +2078,7 @@ ReconTaskParameterPB::sinogram_data() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 ReconTaskParameterPB::_internal_mutable_sinogram_data() {
-  return &sinogram_data_;
+  return &_impl_.sinogram_data_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 ReconTaskParameterPB::mutable_sinogram_data() {
@@ -1901,27 +2088,27 @@ ReconTaskParameterPB::mutable_sinogram_data() {
 
 // repeated double restored_sinogram_data = 25;
 inline int ReconTaskParameterPB::_internal_restored_sinogram_data_size() const {
-  return restored_sinogram_data_.size();
+  return _impl_.restored_sinogram_data_.size();
 }
 inline int ReconTaskParameterPB::restored_sinogram_data_size() const {
   return _internal_restored_sinogram_data_size();
 }
 inline void ReconTaskParameterPB::clear_restored_sinogram_data() {
-  restored_sinogram_data_.Clear();
+  _impl_.restored_sinogram_data_.Clear();
 }
 inline double ReconTaskParameterPB::_internal_restored_sinogram_data(int index) const {
-  return restored_sinogram_data_.Get(index);
+  return _impl_.restored_sinogram_data_.Get(index);
 }
 inline double ReconTaskParameterPB::restored_sinogram_data(int index) const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.restored_sinogram_data)
   return _internal_restored_sinogram_data(index);
 }
 inline void ReconTaskParameterPB::set_restored_sinogram_data(int index, double value) {
-  restored_sinogram_data_.Set(index, value);
+  _impl_.restored_sinogram_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.restored_sinogram_data)
 }
 inline void ReconTaskParameterPB::_internal_add_restored_sinogram_data(double value) {
-  restored_sinogram_data_.Add(value);
+  _impl_.restored_sinogram_data_.Add(value);
 }
 inline void ReconTaskParameterPB::add_restored_sinogram_data(double value) {
   _internal_add_restored_sinogram_data(value);
@@ -1929,7 +2116,7 @@ inline void ReconTaskParameterPB::add_restored_sinogram_data(double value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 ReconTaskParameterPB::_internal_restored_sinogram_data() const {
-  return restored_sinogram_data_;
+  return _impl_.restored_sinogram_data_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 ReconTaskParameterPB::restored_sinogram_data() const {
@@ -1938,7 +2125,7 @@ ReconTaskParameterPB::restored_sinogram_data() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 ReconTaskParameterPB::_internal_mutable_restored_sinogram_data() {
-  return &restored_sinogram_data_;
+  return &_impl_.restored_sinogram_data_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 ReconTaskParameterPB::mutable_restored_sinogram_data() {
@@ -1948,27 +2135,27 @@ ReconTaskParameterPB::mutable_restored_sinogram_data() {
 
 // repeated double reconstructed_tomographs_data = 26;
 inline int ReconTaskParameterPB::_internal_reconstructed_tomographs_data_size() const {
-  return reconstructed_tomographs_data_.size();
+  return _impl_.reconstructed_tomographs_data_.size();
 }
 inline int ReconTaskParameterPB::reconstructed_tomographs_data_size() const {
   return _internal_reconstructed_tomographs_data_size();
 }
 inline void ReconTaskParameterPB::clear_reconstructed_tomographs_data() {
-  reconstructed_tomographs_data_.Clear();
+  _impl_.reconstructed_tomographs_data_.Clear();
 }
 inline double ReconTaskParameterPB::_internal_reconstructed_tomographs_data(int index) const {
-  return reconstructed_tomographs_data_.Get(index);
+  return _impl_.reconstructed_tomographs_data_.Get(index);
 }
 inline double ReconTaskParameterPB::reconstructed_tomographs_data(int index) const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.reconstructed_tomographs_data)
   return _internal_reconstructed_tomographs_data(index);
 }
 inline void ReconTaskParameterPB::set_reconstructed_tomographs_data(int index, double value) {
-  reconstructed_tomographs_data_.Set(index, value);
+  _impl_.reconstructed_tomographs_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.reconstructed_tomographs_data)
 }
 inline void ReconTaskParameterPB::_internal_add_reconstructed_tomographs_data(double value) {
-  reconstructed_tomographs_data_.Add(value);
+  _impl_.reconstructed_tomographs_data_.Add(value);
 }
 inline void ReconTaskParameterPB::add_reconstructed_tomographs_data(double value) {
   _internal_add_reconstructed_tomographs_data(value);
@@ -1976,7 +2163,7 @@ inline void ReconTaskParameterPB::add_reconstructed_tomographs_data(double value
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 ReconTaskParameterPB::_internal_reconstructed_tomographs_data() const {
-  return reconstructed_tomographs_data_;
+  return _impl_.reconstructed_tomographs_data_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 ReconTaskParameterPB::reconstructed_tomographs_data() const {
@@ -1985,7 +2172,7 @@ ReconTaskParameterPB::reconstructed_tomographs_data() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 ReconTaskParameterPB::_internal_mutable_reconstructed_tomographs_data() {
-  return &reconstructed_tomographs_data_;
+  return &_impl_.reconstructed_tomographs_data_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 ReconTaskParameterPB::mutable_reconstructed_tomographs_data() {
@@ -1995,26 +2182,26 @@ ReconTaskParameterPB::mutable_reconstructed_tomographs_data() {
 
 // required bool done = 27;
 inline bool ReconTaskParameterPB::_internal_has_done() const {
-  bool value = (_has_bits_[0] & 0x00040000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_done() const {
   return _internal_has_done();
 }
 inline void ReconTaskParameterPB::clear_done() {
-  done_ = false;
-  _has_bits_[0] &= ~0x00040000u;
+  _impl_.done_ = false;
+  _impl_._has_bits_[0] &= ~0x00040000u;
 }
 inline bool ReconTaskParameterPB::_internal_done() const {
-  return done_;
+  return _impl_.done_;
 }
 inline bool ReconTaskParameterPB::done() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.done)
   return _internal_done();
 }
 inline void ReconTaskParameterPB::_internal_set_done(bool value) {
-  _has_bits_[0] |= 0x00040000u;
-  done_ = value;
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.done_ = value;
 }
 inline void ReconTaskParameterPB::set_done(bool value) {
   _internal_set_done(value);
@@ -2023,26 +2210,26 @@ inline void ReconTaskParameterPB::set_done(bool value) {
 
 // required bool loaded = 28;
 inline bool ReconTaskParameterPB::_internal_has_loaded() const {
-  bool value = (_has_bits_[0] & 0x00080000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_loaded() const {
   return _internal_has_loaded();
 }
 inline void ReconTaskParameterPB::clear_loaded() {
-  loaded_ = false;
-  _has_bits_[0] &= ~0x00080000u;
+  _impl_.loaded_ = false;
+  _impl_._has_bits_[0] &= ~0x00080000u;
 }
 inline bool ReconTaskParameterPB::_internal_loaded() const {
-  return loaded_;
+  return _impl_.loaded_;
 }
 inline bool ReconTaskParameterPB::loaded() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.loaded)
   return _internal_loaded();
 }
 inline void ReconTaskParameterPB::_internal_set_loaded(bool value) {
-  _has_bits_[0] |= 0x00080000u;
-  loaded_ = value;
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.loaded_ = value;
 }
 inline void ReconTaskParameterPB::set_loaded(bool value) {
   _internal_set_loaded(value);
@@ -2051,15 +2238,15 @@ inline void ReconTaskParameterPB::set_loaded(bool value) {
 
 // required string path_model = 29;
 inline bool ReconTaskParameterPB::_internal_has_path_model() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_path_model() const {
   return _internal_has_path_model();
 }
 inline void ReconTaskParameterPB::clear_path_model() {
-  path_model_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.path_model_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
 inline const std::string& ReconTaskParameterPB::path_model() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.path_model)
@@ -2068,8 +2255,8 @@ inline const std::string& ReconTaskParameterPB::path_model() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_path_model(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000040u;
- path_model_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000040u;
+ _impl_.path_model_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.path_model)
 }
 inline std::string* ReconTaskParameterPB::mutable_path_model() {
@@ -2078,41 +2265,40 @@ inline std::string* ReconTaskParameterPB::mutable_path_model() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_path_model() const {
-  return path_model_.Get();
+  return _impl_.path_model_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_path_model(const std::string& value) {
-  _has_bits_[0] |= 0x00000040u;
-  path_model_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.path_model_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_path_model() {
-  _has_bits_[0] |= 0x00000040u;
-  return path_model_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000040u;
+  return _impl_.path_model_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_path_model() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.path_model)
   if (!_internal_has_path_model()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000040u;
-  auto* p = path_model_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  auto* p = _impl_.path_model_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_model_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_model_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_model_.IsDefault()) {
+    _impl_.path_model_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_path_model(std::string* path_model) {
   if (path_model != nullptr) {
-    _has_bits_[0] |= 0x00000040u;
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000040u;
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
-  path_model_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path_model,
-      GetArenaForAllocation());
+  _impl_.path_model_.SetAllocated(path_model, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (path_model_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    path_model_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.path_model_.IsDefault()) {
+    _impl_.path_model_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.path_model)
@@ -2120,15 +2306,15 @@ inline void ReconTaskParameterPB::set_allocated_path_model(std::string* path_mod
 
 // required string sinogram_info = 30;
 inline bool ReconTaskParameterPB::_internal_has_sinogram_info() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_sinogram_info() const {
   return _internal_has_sinogram_info();
 }
 inline void ReconTaskParameterPB::clear_sinogram_info() {
-  sinogram_info_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.sinogram_info_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
 inline const std::string& ReconTaskParameterPB::sinogram_info() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.sinogram_info)
@@ -2137,8 +2323,8 @@ inline const std::string& ReconTaskParameterPB::sinogram_info() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ReconTaskParameterPB::set_sinogram_info(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000080u;
- sinogram_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000080u;
+ _impl_.sinogram_info_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.sinogram_info)
 }
 inline std::string* ReconTaskParameterPB::mutable_sinogram_info() {
@@ -2147,41 +2333,40 @@ inline std::string* ReconTaskParameterPB::mutable_sinogram_info() {
   return _s;
 }
 inline const std::string& ReconTaskParameterPB::_internal_sinogram_info() const {
-  return sinogram_info_.Get();
+  return _impl_.sinogram_info_.Get();
 }
 inline void ReconTaskParameterPB::_internal_set_sinogram_info(const std::string& value) {
-  _has_bits_[0] |= 0x00000080u;
-  sinogram_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.sinogram_info_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::_internal_mutable_sinogram_info() {
-  _has_bits_[0] |= 0x00000080u;
-  return sinogram_info_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000080u;
+  return _impl_.sinogram_info_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReconTaskParameterPB::release_sinogram_info() {
   // @@protoc_insertion_point(field_release:recontaskparameter_pb.ReconTaskParameterPB.sinogram_info)
   if (!_internal_has_sinogram_info()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000080u;
-  auto* p = sinogram_info_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  auto* p = _impl_.sinogram_info_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (sinogram_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    sinogram_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.sinogram_info_.IsDefault()) {
+    _impl_.sinogram_info_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ReconTaskParameterPB::set_allocated_sinogram_info(std::string* sinogram_info) {
   if (sinogram_info != nullptr) {
-    _has_bits_[0] |= 0x00000080u;
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    _has_bits_[0] &= ~0x00000080u;
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
-  sinogram_info_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), sinogram_info,
-      GetArenaForAllocation());
+  _impl_.sinogram_info_.SetAllocated(sinogram_info, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (sinogram_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    sinogram_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.sinogram_info_.IsDefault()) {
+    _impl_.sinogram_info_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:recontaskparameter_pb.ReconTaskParameterPB.sinogram_info)
@@ -2189,32 +2374,202 @@ inline void ReconTaskParameterPB::set_allocated_sinogram_info(std::string* sinog
 
 // required int32 resolution = 31;
 inline bool ReconTaskParameterPB::_internal_has_resolution() const {
-  bool value = (_has_bits_[0] & 0x04000000u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x04000000u) != 0;
   return value;
 }
 inline bool ReconTaskParameterPB::has_resolution() const {
   return _internal_has_resolution();
 }
 inline void ReconTaskParameterPB::clear_resolution() {
-  resolution_ = 0;
-  _has_bits_[0] &= ~0x04000000u;
+  _impl_.resolution_ = 0;
+  _impl_._has_bits_[0] &= ~0x04000000u;
 }
 inline int32_t ReconTaskParameterPB::_internal_resolution() const {
-  return resolution_;
+  return _impl_.resolution_;
 }
 inline int32_t ReconTaskParameterPB::resolution() const {
   // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.resolution)
   return _internal_resolution();
 }
 inline void ReconTaskParameterPB::_internal_set_resolution(int32_t value) {
-  _has_bits_[0] |= 0x04000000u;
-  resolution_ = value;
+  _impl_._has_bits_[0] |= 0x04000000u;
+  _impl_.resolution_ = value;
 }
 inline void ReconTaskParameterPB::set_resolution(int32_t value) {
   _internal_set_resolution(value);
   // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.resolution)
 }
 
+// optional bool reconstruct_volume = 32;
+inline bool ReconTaskParameterPB::_internal_has_reconstruct_volume() const {
+  bool value = (_impl_._has_bits_[0] & 0x08000000u) != 0;
+  return value;
+}
+inline bool ReconTaskParameterPB::has_reconstruct_volume() const {
+  return _internal_has_reconstruct_volume();
+}
+inline void ReconTaskParameterPB::clear_reconstruct_volume() {
+  _impl_.reconstruct_volume_ = false;
+  _impl_._has_bits_[0] &= ~0x08000000u;
+}
+inline bool ReconTaskParameterPB::_internal_reconstruct_volume() const {
+  return _impl_.reconstruct_volume_;
+}
+inline bool ReconTaskParameterPB::reconstruct_volume() const {
+  // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.reconstruct_volume)
+  return _internal_reconstruct_volume();
+}
+inline void ReconTaskParameterPB::_internal_set_reconstruct_volume(bool value) {
+  _impl_._has_bits_[0] |= 0x08000000u;
+  _impl_.reconstruct_volume_ = value;
+}
+inline void ReconTaskParameterPB::set_reconstruct_volume(bool value) {
+  _internal_set_reconstruct_volume(value);
+  // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.reconstruct_volume)
+}
+
+// optional int32 slice_begin = 33 [default = 0];
+inline bool ReconTaskParameterPB::_internal_has_slice_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x10000000u) != 0;
+  return value;
+}
+inline bool ReconTaskParameterPB::has_slice_begin() const {
+  return _internal_has_slice_begin();
+}
+inline void ReconTaskParameterPB::clear_slice_begin() {
+  _impl_.slice_begin_ = 0;
+  _impl_._has_bits_[0] &= ~0x10000000u;
+}
+inline int32_t ReconTaskParameterPB::_internal_slice_begin() const {
+  return _impl_.slice_begin_;
+}
+inline int32_t ReconTaskParameterPB::slice_begin() const {
+  // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.slice_begin)
+  return _internal_slice_begin();
+}
+inline void ReconTaskParameterPB::_internal_set_slice_begin(int32_t value) {
+  _impl_._has_bits_[0] |= 0x10000000u;
+  _impl_.slice_begin_ = value;
+}
+inline void ReconTaskParameterPB::set_slice_begin(int32_t value) {
+  _internal_set_slice_begin(value);
+  // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.slice_begin)
+}
+
+// optional int32 slice_end = 34 [default = -1];
+inline bool ReconTaskParameterPB::_internal_has_slice_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x80000000u) != 0;
+  return value;
+}
+inline bool ReconTaskParameterPB::has_slice_end() const {
+  return _internal_has_slice_end();
+}
+inline void ReconTaskParameterPB::clear_slice_end() {
+  _impl_.slice_end_ = -1;
+  _impl_._has_bits_[0] &= ~0x80000000u;
+}
+inline int32_t ReconTaskParameterPB::_internal_slice_end() const {
+  return _impl_.slice_end_;
+}
+inline int32_t ReconTaskParameterPB::slice_end() const {
+  // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.slice_end)
+  return _internal_slice_end();
+}
+inline void ReconTaskParameterPB::_internal_set_slice_end(int32_t value) {
+  _impl_._has_bits_[0] |= 0x80000000u;
+  _impl_.slice_end_ = value;
+}
+inline void ReconTaskParameterPB::set_slice_end(int32_t value) {
+  _internal_set_slice_end(value);
+  // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.slice_end)
+}
+
+// optional int32 snapshot_interval = 35 [default = 5];
+inline bool ReconTaskParameterPB::_internal_has_snapshot_interval() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReconTaskParameterPB::has_snapshot_interval() const {
+  return _internal_has_snapshot_interval();
+}
+inline void ReconTaskParameterPB::clear_snapshot_interval() {
+  _impl_.snapshot_interval_ = 5;
+  _impl_._has_bits_[1] &= ~0x00000001u;
+}
+inline int32_t ReconTaskParameterPB::_internal_snapshot_interval() const {
+  return _impl_.snapshot_interval_;
+}
+inline int32_t ReconTaskParameterPB::snapshot_interval() const {
+  // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.snapshot_interval)
+  return _internal_snapshot_interval();
+}
+inline void ReconTaskParameterPB::_internal_set_snapshot_interval(int32_t value) {
+  _impl_._has_bits_[1] |= 0x00000001u;
+  _impl_.snapshot_interval_ = value;
+}
+inline void ReconTaskParameterPB::set_snapshot_interval(int32_t value) {
+  _internal_set_snapshot_interval(value);
+  // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.snapshot_interval)
+}
+
+// optional .recontaskparameter_pb.ReconTaskParameterPB.ModelPrecision model_precision = 36 [default = MODEL_FP32];
+inline bool ReconTaskParameterPB::_internal_has_model_precision() const {
+  bool value = (_impl_._has_bits_[0] & 0x20000000u) != 0;
+  return value;
+}
+inline bool ReconTaskParameterPB::has_model_precision() const {
+  return _internal_has_model_precision();
+}
+inline void ReconTaskParameterPB::clear_model_precision() {
+  _impl_.model_precision_ = 0;
+  _impl_._has_bits_[0] &= ~0x20000000u;
+}
+inline ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::_internal_model_precision() const {
+  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision >(_impl_.model_precision_);
+}
+inline ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision ReconTaskParameterPB::model_precision() const {
+  // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.model_precision)
+  return _internal_model_precision();
+}
+inline void ReconTaskParameterPB::_internal_set_model_precision(::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision value) {
+  assert(::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision_IsValid(value));
+  _impl_._has_bits_[0] |= 0x20000000u;
+  _impl_.model_precision_ = value;
+}
+inline void ReconTaskParameterPB::set_model_precision(::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision value) {
+  _internal_set_model_precision(value);
+  // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.model_precision)
+}
+
+// optional .recontaskparameter_pb.ReconTaskParameterPB.RestoredOutput restored_output = 37 [default = RESTORED_FLOAT64];
+inline bool ReconTaskParameterPB::_internal_has_restored_output() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReconTaskParameterPB::has_restored_output() const {
+  return _internal_has_restored_output();
+}
+inline void ReconTaskParameterPB::clear_restored_output() {
+  _impl_.restored_output_ = 2;
+  _impl_._has_bits_[1] &= ~0x00000002u;
+}
+inline ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::_internal_restored_output() const {
+  return static_cast< ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput >(_impl_.restored_output_);
+}
+inline ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput ReconTaskParameterPB::restored_output() const {
+  // @@protoc_insertion_point(field_get:recontaskparameter_pb.ReconTaskParameterPB.restored_output)
+  return _internal_restored_output();
+}
+inline void ReconTaskParameterPB::_internal_set_restored_output(::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput value) {
+  assert(::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput_IsValid(value));
+  _impl_._has_bits_[1] |= 0x00000002u;
+  _impl_.restored_output_ = value;
+}
+inline void ReconTaskParameterPB::set_restored_output(::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput value) {
+  _internal_set_restored_output(value);
+  // @@protoc_insertion_point(field_set:recontaskparameter_pb.ReconTaskParameterPB.restored_output)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -2240,6 +2595,16 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType>() {
   return ::recontaskparameter_pb::ReconTaskParameterPB_FileDataType_descriptor();
 }
+template <> struct is_proto_enum< ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision>() {
+  return ::recontaskparameter_pb::ReconTaskParameterPB_ModelPrecision_descriptor();
+}
+template <> struct is_proto_enum< ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput>() {
+  return ::recontaskparameter_pb::ReconTaskParameterPB_RestoredOutput_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -2,31 +2,84 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDir>
 #include <QDebug>
 #include <QElapsedTimer>
+#include <QSaveFile>
 
+#include "error_code.h"
 #include "global_defs.h"
 #include "spect.h"
 #include "scascnet.h"
 #include "sinogram.h"
+#include "inferenceservice.h"
+#include "sinogramrestorer.h"
+#include "spectengine.h"
+#include "threadbudget.h"
+#include "utils.h"
+
+namespace {
+
+// The library writes the progress of a slice through a plain int pointer.
+// Reading it with an atomic load keeps the sampling free of data races.
+int LoadRelaxed(const int *value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(value, __ATOMIC_RELAXED);
+#else
+    // Aligned int reads are atomic on the platforms MSVC targets.
+    return *static_cast<const volatile int *>(value);
+#endif
+}
+
+void StoreRelaxed(int *value, int new_value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(value, new_value, __ATOMIC_RELAXED);
+#else
+    *static_cast<volatile int *>(value) = new_value;
+#endif
+}
+
+// Bumped whenever the key of the result cache changes meaning.
+const int kResultKeyVersion = 3;
+// Bumped whenever restoration changes what it produces for the same inputs.
+const int kRestorationKeyVersion = 4;
+
+// Progress is published no more often than the display can show it.
+const int kProgressIntervalMs = 16;
+
+} // namespace
 
 ReconThread::ReconThread(QObject *parent):
     QThread(parent)
 {
-    // 初始化内存全局变量
-    SPECTSetLogLevel(LOG_INFO, true);
-    int rv = SPECTInitialize();
-    if (0 != rv) {
-        qDebug() << __FUNCTION__ << ": ";
-        qDebug() << "Fail to init planning..., error:%s\n";
-        qDebug() << SPECTGetErrString((ERR_CODE)rv) << endl;
-    }
 }
 
-void ReconThread::SetParameter(ReconTaskParameter &param) {
+int ReconThread::SetParameter(const ReconTaskParameter &param) {
+    // The arrays are shared, so keeping the parameter for the run is cheap.
+    // The slow preparation, e.g. restoration, is done on the thread in run().
+    const Tensor& sinogram = param.data->sinogram;
+    if (sinogram.shape().size() != 3 || sinogram.shape()[0] == 0) {
+        qDebug() << "No sinogram loaded for task " << param.task_name << endl;
+        return EINVLIAD_VALUE;
+    }
+    if (param.use_nn && !QFileInfo::exists(param.GetModelPath())) {
+        qDebug() << "Restoration model not found: " << param.GetModelPath() << endl;
+        return EINVALID_PATH;
+    }
+    param_ = param;
+    control_.Reset();
     spect_param_.io_param.load_sinogram_from_file = false;
     const int num_detectors = param.num_detectors;
     const int num_angles = param.num_angles;
@@ -41,8 +94,6 @@ void ReconThread::SetParameter(ReconTaskParameter &param) {
     spect_param_.size_recon = num_detectors * num_detectors;
     spect_param_.size_proj = num_detectors * num_angles;
 
-    QString base_dir = kBaseDir;
-
     spect_param_.io_param.sino_path = param.path_sinogram.toStdString();
     spect_param_.io_param.sysmat_path = param.path_sysmat.toStdString();
     spect_param_.io_param.sca_path = param.path_scatter_map.toStdString();
@@ -58,75 +109,27 @@ void ReconThread::SetParameter(ReconTaskParameter &param) {
     spect_param_.io_param.recon_hr_filename = basename.toStdString();
 
     // Setup output directory.
-    QString outputDir = param.output_dir.trimmed();
-    if (QDir(outputDir).isRelative()) {
-        QDir d = QDir(base_dir);
-        outputDir = d.filePath(outputDir);
-        d = QDir(outputDir);
-        d.mkpath(basename);
-        outputDir = d.filePath(basename);
-    }
+    QString outputDir = param.GetResolvedOutputDir();
+    QDir().mkpath(outputDir);
+    output_dir_ = outputDir;
     spect_param_.io_param.outputdir = outputDir.toStdString();
 
-    spect_param_.io_param.sinogram_data.resize(num_angles * num_detectors);
-
-    if (param.use_nn && param.num_detectors == kNumDetectors
-            && param.num_angles == kNumAngles) {
-        const int sinogram_start_index = std::max<int>(param.index_sinogram - kNumSlices / 2 + 1, 0);
-        const int sinogram_inner_index = param.index_sinogram - sinogram_start_index;
-        assert (sinogram_inner_index >= 0);
-        const int sinogram_end_index = std::min<int>(sinogram_start_index + kNumSlices, param.sinogram.shape()[0]);
-        std::vector<double> buff(kNumSlices * kNumAngles * kNumDetectors);
-        const int element_start_index = sinogram_start_index * kNumDetectors * kNumAngles;
-        for (int i = 0; i < (sinogram_end_index - sinogram_start_index) * kNumAngles * kNumDetectors; ++i) {
-            buff[i] = param.sinogram.data()[element_start_index + i];
-        }
-        Sinogram<double> input_sinogram(buff, kNumSlices, kNumAngles, kNumDetectors);
-        Sinogram<double> restored_sinogram;
-
-#ifdef WIN32
-        ORTCHAR_T model_name_buffer[512];
-        int len = param.path_model.toWCharArray(model_name_buffer);
-        model_name_buffer[len] = L'\0';
-        qDebug() << "Building model (Model path: " << param.path_model << ")..." << endl;
-        Scascnet net(model_name_buffer);
-#else
-        Scascnet net(param.path_model.toStdString().c_str());
-#endif
-        std::cout << "Performing restoration..." << std::endl;
-        QElapsedTimer timer;
-        timer.start();
-        restored_sinogram = net.Run(input_sinogram.TransformType<float>()).TransformType<double>();
-        qDebug() << "Time consumed for restoration: " << timer.elapsed() << " (ms)." << endl;
-        qDebug() << "Restoration completed." << endl;
-
-        QFileInfo info_input_sinogram(param.path_sinogram);
-        std::string restoredSinogramOutputPath = QDir(outputDir).filePath(
-                    info_input_sinogram.fileName() + ".resf").toStdString();
-
-        restoredSinogramOutputPath = QDir(outputDir).filePath(
-                    info_input_sinogram.fileName() + ".resd").toStdString();
-        restored_sinogram.WriteToFilePath(restoredSinogramOutputPath);
-
-        spect_param_.io_param.sino_path = restoredSinogramOutputPath;
-        qDebug() << "Restored sinogram saved to "
-            << QString::fromStdString(restoredSinogramOutputPath) << endl;
-
-        for (int i = 0, j = sinogram_inner_index * kNumAngles * kNumDetectors;
-             i < kNumAngles * kNumDetectors; ++i, ++j) {
-            spect_param_.io_param.sinogram_data[i] = restored_sinogram.GetData()[j];
-        }
-    } else {
-        const int offset = param.index_sinogram * num_detectors * num_angles;
-        for (int i = 0; i < num_detectors * num_angles; ++i) {
-            spect_param_.io_param.sinogram_data[i] = param.sinogram.data()[offset + i];
+    // Collect the slices to reconstruct.
+    const int slice_size = num_angles * num_detectors;
+    int slice_begin = 0;
+    int slice_end = 0;
+    param.GetSliceRange(&slice_begin, &slice_end);
+    slice_jobs_.clear();
+    slice_jobs_.resize(slice_end - slice_begin);
+    index_display_job_ = slice_jobs_.size() / 2;
+    for (size_t i = 0; i < slice_jobs_.size(); ++i) {
+        slice_jobs_[i].slice_index = slice_begin + static_cast<int>(i);
+        slice_jobs_[i].sinogram_data.resize(slice_size);
+        if (slice_jobs_[i].slice_index == param.index_sinogram) {
+            index_display_job_ = i;
         }
     }
 
-
-    param.sinogram_used_to_reconstruct = Tensor({num_angles, num_detectors}, spect_param_.io_param.sinogram_data);
-    param.sinogram_used_to_reconstruct.NormalizeInPlace();
-
     spect_param_.io_param.asum_filename = (basename + ".asum").toStdString();
 
     if (param.iterator_type == "EM-Tikhonov") spect_param_.iterator_type = EM_TIKHONOV;
@@ -139,7 +142,7 @@ void ReconThread::SetParameter(ReconTaskParameter &param) {
     else if (param.iterator_type == "MLEM") spect_param_.iterator_type = MLEM;
     else {
         qDebug() << "Invalid iterator_type: " << param.iterator_type << endl;
-        exit(-1);
+        return EINVLIAD_VALUE;
     }
 
     // Set filter
@@ -150,40 +153,425 @@ void ReconThread::SetParameter(ReconTaskParameter &param) {
         spect_param_.filtering = true;
         spect_param_.filter_type = FilterType::kMeanFilterDropMinMax;
     }
-    spect_param_.Print();
+    return 0;
 }
 
 void ReconThread::run()
 {
-    Reconstruct();
+    progress_ = 0;
+    ms_per_iteration_ = 0;
+    eta_ms_ = -1;
+    emit(Progress());
+    result_array_.reset();
+    result_image_array_.clear();
+    result_iter_index_array_.clear();
+    result_volume_ = Tensor();
+    stage_timings_ = StageTimings();
+    QElapsedTimer timer;
+    timer.start();
+    // An exception must not leave the thread, where it would terminate the
+    // whole application. The task ends with progress below 100 and is
+    // reported as failed.
+    try {
+        const bool prepared = PrepareSliceJobs_();
+        stage_timings_.prepare_ms = timer.elapsed();
+        if (!prepared) return;
+        Reconstruct();
+    } catch (const Ort::Exception& e) {
+        qDebug() << "Restoration of task " << param_.task_name << " failed: " << e.what() << endl;
+    } catch (const std::exception& e) {
+        qDebug() << "Task " << param_.task_name << " failed: " << e.what() << endl;
+    }
+}
+
+bool ReconThread::PrepareSliceJobs_()
+{
+    const ReconTaskParameter& param = param_;
+    const int num_detectors = param.num_detectors;
+    const int num_angles = param.num_angles;
+    if (slice_jobs_.empty()) return false;
+
+    // The library loads the matrix by path when the run starts, which reads
+    // from the page cache if the read-ahead got there first.
+    SysmatPrefetcher& prefetcher = SpectEngine::Instance().GetSysmatPrefetcher();
+    prefetcher.Prefetch(param.path_sysmat);
+    qDebug() << "System matrix read ahead: " << prefetcher.GetNumFirsts() << " new file(s), "
+             << prefetcher.GetNumRepeats() << " repeat(s), "
+             << prefetcher.GetNumBytes() / (1024 * 1024) << " MB requested in total." << endl;
+
+    // The restorer adapts any geometry to the model.
+    if (param.use_nn) {
+        const int range_begin = slice_jobs_.front().slice_index;
+        const int range_end = slice_jobs_.back().slice_index + 1;
+        // Restored slices are kept by the task, or handed over by an earlier
+        // pipeline stage, so that the network is skipped when they fit.
+        const QByteArray key = GetRestorationKey(param);
+        if (!restored_ || !restored_->Covers(key, range_begin, range_end)) {
+            QElapsedTimer timer;
+            timer.start();
+            SharedRestoredSinogram restored = Restore(
+                        param, key, [this]() { return control_.WaitWhilePaused(); });
+            if (!restored) return false;
+            stage_timings_.restoration_ms += timer.elapsed();
+            restored_ = std::move(restored);
+        }
+
+        const size_t slice_size = static_cast<size_t>(num_angles) * num_detectors;
+        const std::vector<double>& restored_data = restored_->sinogram.data();
+        for (auto& job: slice_jobs_) {
+            std::copy(restored_data.cbegin() + job.slice_index * slice_size,
+                      restored_data.cbegin() + (job.slice_index + 1) * slice_size,
+                      job.sinogram_data.begin());
+        }
+
+        // The reconstruction reads the restored slices from memory, so the
+        // file is written in the background.
+        if (param.restored_output != ReconTaskParameter::RestoredOutput::ReconTaskParameterPB_RestoredOutput_RESTORED_NONE) {
+            WriteRestoredSinogram_();
+        }
+    } else {
+        const std::vector<double>& sinogram_data = param.data->sinogram.data();
+        for (auto& job: slice_jobs_) {
+            const int offset = job.slice_index * num_detectors * num_angles;
+            for (int i = 0; i < num_detectors * num_angles; ++i) {
+                job.sinogram_data[i] = sinogram_data[offset + i];
+            }
+        }
+    }
+    spect_param_.io_param.sinogram_data = slice_jobs_[index_display_job_].sinogram_data;
+
+    sinogram_used_to_reconstruct_ = Tensor({num_angles, num_detectors}, spect_param_.io_param.sinogram_data);
+    sinogram_used_to_reconstruct_.NormalizeInPlace();
+
+    fingerprint_ = param.GetStateFingerprint();
+
+    if (resume_from_checkpoint_) {
+        CheckpointSlices slices;
+        const int num_read = ReadCheckpoint(param.GetCheckpointPath(), GetCheckpointHeader_(), &slices);
+        for (auto& job: slice_jobs_) {
+            auto it = slices.find(job.slice_index);
+            if (it == slices.end()) continue;
+            job.recon_result_array = std::move(it->second);
+            job.progress = 100;
+            job.done = true;
+        }
+        qDebug() << "Resumed " << std::max(num_read, 0) << " slice(s) from checkpoint." << endl;
+    }
+    spect_param_.Print();
+    return true;
 }
 
 void ReconThread::Reconstruct()
 {
-    progress_ = 0;
-    int step_temporary_result = 5;
-    result_array_.clear();
-    result_iter_index_array_.clear();
+    const int step_temporary_result = std::max(1, param_.snapshot_interval);
 
     QElapsedTimer timer;
     timer.start();
-    SPECTProject spect_project;
-    spect_project.SetSpectParams(spect_param_);
 
-    std::vector<std::vector<double> > recon_result_array;
-    spect_project.GenerateBackProject(&progress_, &recon_result_array, step_temporary_result);
-    std::cout << "Time consumed for reconstruction: "
+    // Slices are reconstructed in parallel. Each worker runs one
+    // SPECTProject at a time and gets an equal share of the thread budget
+    // for OpenMP, so the machine is never oversubscribed.
+    const int num_jobs = static_cast<int>(slice_jobs_.size());
+    const int num_threads = thread_budget_ > 0 ? thread_budget_ : GetHardwareThreadCount();
+    const int num_workers = std::max(1, std::min(num_jobs, num_threads));
+    const int num_omp_threads = std::max(1, num_threads / num_workers);
+    std::atomic<int> next_job(0);
+    std::mutex mutex;
+    std::condition_variable cv_finished;
+    int num_finished_workers = 0;
+    // Completed slices of a volume are checkpointed as they come, so that
+    // an interrupted run can be resumed.
+    std::unique_ptr<CheckpointWriter> checkpoint;
+    if (num_jobs > 1) {
+        checkpoint.reset(new CheckpointWriter(param_.GetCheckpointPath(), GetCheckpointHeader_()));
+        for (const auto& job: slice_jobs_) {
+            if (job.done) checkpoint->Append(job.slice_index, job.recon_result_array);
+        }
+    }
+    std::vector<std::thread> workers;
+    for (int w = 0; w < num_workers; ++w) {
+        workers.emplace_back([&]() {
+            SetOmpThreadCount(num_omp_threads);
+            // SPECTProject cannot be interrupted, so pausing and cancelling
+            // take effect before the next slice is started.
+            while (control_.WaitWhilePaused()) {
+                int i = next_job++;
+                if (i >= num_jobs) break;
+                SliceJob& job = slice_jobs_[i];
+                if (job.done) continue;
+                ReconstructSlice_(job);
+                if (checkpoint && job.progress == 100) {
+                    checkpoint->Append(job.slice_index, job.recon_result_array);
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            ++num_finished_workers;
+            cv_finished.notify_one();
+        });
+    }
+    // Report the mean progress of the slices while the workers are busy.
+    auto sample_progress = [&]() {
+        int sum = 0;
+        for (const auto& job: slice_jobs_) sum += LoadRelaxed(&job.progress);
+        return num_jobs > 0 ? sum / num_jobs : 0;
+    };
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!cv_finished.wait_for(lock, std::chrono::milliseconds(kProgressIntervalMs),
+                                     [&]() { return num_finished_workers == num_workers; })) {
+            PublishProgress_(sample_progress(), timer.elapsed());
+        }
+    }
+    for (auto& worker: workers) {
+        worker.join();
+    }
+    PublishProgress_(sample_progress(), timer.elapsed());
+    if (checkpoint && progress_ == 100) checkpoint->Discard();
+    std::cout << "Time consumed for reconstruction of " << num_jobs << " slice(s) with "
+              << num_workers << " worker(s) x " << num_omp_threads << " OpenMP thread(s): "
               << timer.elapsed() << " (ms)." << endl;
+    stage_timings_.reconstruction_ms = timer.elapsed();
+    timer.restart();
+    if (num_jobs == 0) return;
+    if (control_.IsCancelled()) {
+        std::cout << "Reconstruction cancelled; the slices completed so far are kept." << std::endl;
+    }
 
     std::vector<int> shape(2);
     shape[0] = spect_param_.rec_ysize;
     shape[1] = spect_param_.rec_xsize;
+    const size_t slice_size = static_cast<size_t>(shape[0]) * shape[1];
+
+    if (num_jobs > 1) {
+        Tensor volume({num_jobs, shape[0], shape[1]});
+        std::vector<double>& volume_data = volume.data();
+        for (int i = 0; i < num_jobs; ++i) {
+            const auto& recon_result_array = slice_jobs_[i].recon_result_array;
+            if (recon_result_array.empty() || recon_result_array[0].size() != slice_size) continue;
+            std::copy(recon_result_array[0].cbegin(), recon_result_array[0].cend(),
+                      volume_data.begin() + i * slice_size);
+        }
+        // Normalized as a whole so that the slices remain comparable.
+        volume.NormalizeInPlace();
+        result_volume_ = std::move(volume);
+    }
+
+    // After a cancellation the preview falls back to any completed slice.
+    if (slice_jobs_[index_display_job_].recon_result_array.empty()) {
+        for (size_t i = 0; i < slice_jobs_.size(); ++i) {
+            if (!slice_jobs_[i].recon_result_array.empty()) {
+                index_display_job_ = i;
+                break;
+            }
+        }
+    }
+    auto& recon_result_array = slice_jobs_[index_display_job_].recon_result_array;
+    auto result_array = std::make_shared<std::vector<Tensor>>();
+    result_array->reserve(recon_result_array.size());
     for (size_t i = 0; i < recon_result_array.size(); ++i) {
         Tensor tensor(shape, std::move(recon_result_array[i]));
         tensor.NormalizeInPlace();
-        result_array_.push_back(std::move(tensor));
+        result_image_array_.push_back(GetImageFromTensor2D(tensor));
+        result_array->push_back(std::move(tensor));
         if (i > 0) {
             result_iter_index_array_.push_back(i * step_temporary_result);
         }
     }
+    result_array_ = std::move(result_array);
+    for (auto& job: slice_jobs_) {
+        job.recon_result_array.clear();
+    }
+    stage_timings_.postprocess_ms = timer.elapsed();
+}
+
+void ReconThread::PublishProgress_(int progress, qint64 elapsed_ms)
+{
+    if (progress == progress_) return;
+    const qint64 num_iters = static_cast<qint64>(spect_param_.num_iters) * slice_jobs_.size();
+    const qint64 num_iters_done = num_iters * progress / 100;
+    if (num_iters_done > 0) ms_per_iteration_ = elapsed_ms / num_iters_done;
+    eta_ms_ = progress > 0 ? elapsed_ms * (100 - progress) / progress : -1;
+    progress_ = progress;
+    emit(Progress());
+}
+
+void ReconThread::ReconstructSlice_(SliceJob& job) const
+{
+    ResultCache& result_cache = SpectEngine::Instance().GetResultCache();
+    const QByteArray key = GetResultKey_(job);
+    if (result_cache.Lookup(key, &job.recon_result_array)) {
+        qDebug() << "Slice " << job.slice_index << " taken from the result cache ("
+                 << result_cache.GetNumHits() << " hit(s), " << result_cache.GetNumMisses()
+                 << " miss(es))." << endl;
+        StoreRelaxed(&job.progress, 100);
+        return;
+    }
+
+    const int step_temporary_result = std::max(1, param_.snapshot_interval);
+    SPECTParam spect_param = spect_param_;
+    spect_param.io_param.sinogram_data = std::move(job.sinogram_data);
+    if (slice_jobs_.size() > 1) {
+        // Keep the files written for each slice apart.
+        char suffix[32];
+        snprintf(suffix, sizeof(suffix), "_slice%03d", job.slice_index);
+        spect_param.io_param.recon_filename += suffix;
+        spect_param.io_param.recon_hr_filename += suffix;
+        spect_param.io_param.asum_filename = spect_param.io_param.recon_filename + ".asum";
+    }
+    SPECTProject spect_project;
+    spect_project.SetSpectParams(spect_param);
+    spect_project.GenerateBackProject(&job.progress, &job.recon_result_array, step_temporary_result);
+    if (job.progress == 100) {
+        result_cache.Store(key, job.recon_result_array);
+    }
+}
+
+ReconThread::SharedRestoredSinogram ReconThread::Restore(const ReconTaskParameter &param,
+                                                         const QByteArray &key,
+                                                         const std::function<bool ()> &keep_going)
+{
+    int range_begin = 0;
+    int range_end = 0;
+    param.GetSliceRange(&range_begin, &range_end);
+    // Runs differing only in reconstruction parameters restore the same
+    // slices, so they are looked up in memory and then in the .resd file a
+    // run over the same sinogram may have left.
+    RestorationCache& cache = SpectEngine::Instance().GetRestorationCache();
+    SharedRestoredSinogram cached = cache.Lookup(key, range_begin, range_end);
+    if (!cached) {
+        cached = RestorationCache::ReadFile(GetRestoredSinogramPath(param, false), key,
+                                            range_begin, range_end);
+        if (cached) cache.Insert(cached);
+    }
+    if (cached) {
+        qDebug() << "Restored sinogram taken from the cache (" << cache.GetNumHits() << " hit(s), "
+                 << cache.GetNumMisses() << " miss(es))." << endl;
+        return cached;
+    }
+
+    // Sessions are kept warm across runs, and windows of concurrent tasks
+    // are batched together by the service.
+    std::shared_ptr<InferenceService> service =
+            SpectEngine::Instance().GetInferenceService(param.GetModelPath());
+    SinogramRestorer restorer(*service, kRestorationOverlap);
+    auto restored = std::make_shared<RestoredSinogram>();
+    restored->key = key;
+    restored->slice_begin = range_begin;
+    restored->slice_end = range_end;
+
+    std::cout << "Performing restoration..." << std::endl;
+    QElapsedTimer timer;
+    timer.start();
+    if (!restorer.Restore(param.data->sinogram, range_begin, range_end, &restored->sinogram, keep_going)) {
+        return nullptr;
+    }
+    qDebug() << "Time consumed for restoration: " << timer.elapsed() << " (ms)." << endl;
+    const InferenceService::Metrics metrics = service->GetMetrics();
+    qDebug() << "Inference service: " << metrics.num_batches << " batch(es), "
+             << metrics.GetMeanBatchSize() << " window(s) per batch, queue latency "
+             << metrics.mean_queue_latency_ms << " (ms) mean, "
+             << metrics.max_queue_latency_ms << " (ms) max." << endl;
+    qDebug() << "Restoration completed." << endl;
+    cache.Insert(restored);
+    return restored;
+}
+
+QString ReconThread::GetRestoredSinogramPath(const ReconTaskParameter &param, bool float32)
+{
+    return QDir(param.GetResolvedOutputDir()).filePath(
+                QFileInfo(param.path_sinogram).fileName() + (float32 ? ".resf" : ".resd"));
+}
+
+void ReconThread::WriteRestoredSinogram_() const
+{
+    const bool as_float32 = param_.restored_output
+            == ReconTaskParameter::RestoredOutput::ReconTaskParameterPB_RestoredOutput_RESTORED_FLOAT32;
+    const QString path = GetRestoredSinogramPath(param_, as_float32);
+    const int slice_begin = slice_jobs_.front().slice_index;
+    const int slice_end = slice_jobs_.back().slice_index + 1;
+    // Reruns that only change reconstruction parameters find the file
+    // written already, and rewriting it would hide it from other tasks.
+    const int element_size = as_float32 ? sizeof(float) : sizeof(double);
+    if (RestorationCache::FileHolds(path, element_size, restored_->key, slice_begin, slice_end)) {
+        return;
+    }
+    // The job owns a reference to the immutable restored slices.
+    SharedRestoredSinogram restored = restored_;
+    SpectEngine::Instance().GetIoThread().Post([restored, path, as_float32, slice_begin, slice_end]() {
+        const std::vector<int>& shape = restored->sinogram.shape();
+        const size_t slice_size = static_cast<size_t>(shape[1]) * shape[2];
+        const size_t offset = slice_begin * slice_size;
+        const size_t count = (slice_end - slice_begin) * slice_size;
+        // The key file goes first, so that it never describes another file.
+        QFile::remove(RestorationCache::GetKeyPath(path));
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly)) {
+            qDebug() << "Cannot write the restored sinogram to " << path << endl;
+            return;
+        }
+        if (as_float32) {
+            // Converted a slice at a time. The float32 mirror of the tensor
+            // would cover every slice and stay with the cached tensor.
+            const std::vector<double>& data = restored->sinogram.data();
+            std::vector<float> buffer(slice_size);
+            for (size_t start = offset; start < offset + count; start += slice_size) {
+                std::copy(data.cbegin() + start, data.cbegin() + start + slice_size, buffer.begin());
+                file.write(reinterpret_cast<const char *>(buffer.data()),
+                           static_cast<qint64>(slice_size * sizeof(float)));
+            }
+        } else {
+            file.write(reinterpret_cast<const char *>(restored->sinogram.data().data() + offset),
+                       static_cast<qint64>(count * sizeof(double)));
+        }
+        if (file.commit()) {
+            RestorationCache::WriteKeyFile(path, *restored, slice_begin, slice_end);
+            qDebug() << "Restored sinogram saved to " << path << endl;
+        } else {
+            qDebug() << "Cannot write the restored sinogram to " << path << endl;
+        }
+    });
+}
+
+QByteArray ReconThread::GetRestorationKey(const ReconTaskParameter &param)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::number(kRestorationKeyVersion));
+    // The contents of the model count, not where it lies.
+    hash.addData(SpectEngine::Instance().GetRestorationCache().GetFileDigest(param.GetModelPath()));
+    hash.addData(QByteArray::number(kRestorationOverlap));
+    // Includes the geometry, which decides how slices are adapted to the
+    // model. It is hashed once for all tasks sharing the sinogram.
+    hash.addData(param.data->GetSinogramDigest());
+    return hash.result();
+}
+
+CheckpointHeader ReconThread::GetCheckpointHeader_() const
+{
+    CheckpointHeader header;
+    header.fingerprint = fingerprint_;
+    header.num_iters_done = spect_param_.num_iters;
+    header.snapshot_interval = std::max(1, param_.snapshot_interval);
+    return header;
+}
+
+QByteArray ReconThread::GetResultKey_(const SliceJob &job) const
+{
+    const ReconTaskParameter& param = param_;
+    QByteArray header;
+    QDataStream stream(&header, QIODevice::WriteOnly);
+    stream << kResultKeyVersion << param.iterator_type << param.num_iters << param.num_dual_iters
+           << param.lambda << param.gamma << param.use_scatter_map << param.coeff_scatter
+           << param.filter_type << param.snapshot_interval << param.num_detectors
+           << param.num_angles << param.use_nn;
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(header);
+    ResultCache::AddFileIdentity(hash, param.path_sysmat);
+    if (param.use_scatter_map) ResultCache::AddFileIdentity(hash, param.path_scatter_map);
+    if (param.use_nn) ResultCache::AddFileIdentity(hash, param.GetModelPath());
+    // The library reads the attenuation map from a fixed path, which a
+    // later task may overwrite.
+    ResultCache::AddFileIdentity(hash, QString::fromStdString(spect_param_.io_param.mumap_path));
+    hash.addData(reinterpret_cast<const char *>(job.sinogram_data.data()),
+                 static_cast<int>(job.sinogram_data.size() * sizeof(double)));
+    return hash.result();
 }
@@ -3,44 +3,166 @@
 
 #include <QThread>
 #include <QVector>
+#include <QImage>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
 #include <vector>
 
 #include "spect.h"
 #include "recontaskparameter.h"
+#include "checkpoint.h"
+#include "reconcontrol.h"
+#include "restorationcache.h"
 
 class ReconThread : public QThread
 {
     Q_OBJECT
 public:
+    // Wall time of the stages of the last run. Restoration is part of
+    // preparation.
+    struct StageTimings {
+        qint64 prepare_ms = 0;
+        qint64 restoration_ms = 0;
+        qint64 reconstruction_ms = 0;
+        qint64 postprocess_ms = 0;
+    };
+
+    // Use SpectEngine::CreateWorker, which initializes the library first.
     ReconThread(QObject *parent);
     ReconThread(ReconThread&& thread):
+        param_(std::move(thread.param_)),
+        output_dir_(std::move(thread.output_dir_)),
         spect_param_(std::move(thread.spect_param_)),
-        progress_(thread.progress_),
-        result_array_(thread.result_array_)
+        progress_(thread.progress_.load()),
+        slice_jobs_(std::move(thread.slice_jobs_)),
+        index_display_job_(thread.index_display_job_),
+        result_array_(std::move(thread.result_array_)),
+        result_image_array_(std::move(thread.result_image_array_)),
+        result_volume_(std::move(thread.result_volume_))
     {}
+    // Progress in percent, safe to read from any thread.
     int GetProgress() const { return progress_; }
-    void SetParameter(ReconTaskParameter& recon_task_param);
-    const std::vector<Tensor>& GetResultArray() const {
-        return result_array_;
+    // Mean wall time per iteration so far, 0 until the first one is done.
+    qint64 GetMsPerIteration() const { return ms_per_iteration_; }
+    // Estimated time left in milliseconds, or -1 if not known yet.
+    qint64 GetEtaMs() const { return eta_ms_; }
+    // Caps the threads of the next run, OpenMP threads of the library
+    // included. Zero or less means all hardware threads.
+    void SetThreadBudget(int num_threads) { thread_budget_ = num_threads; }
+    typedef ::RestoredSinogram RestoredSinogram;
+    typedef ::SharedRestoredSinogram SharedRestoredSinogram;
+
+    // Returns 0 on success, or an error code if the parameter is unusable.
+    int SetParameter(const ReconTaskParameter& recon_task_param);
+    // Pausing and cancelling are honoured between restoration windows and
+    // between slices; the slices completed before a cancellation are kept.
+    void Pause() { control_.Pause(); }
+    void Resume() { control_.Resume(); }
+    void Cancel() { control_.Cancel(); }
+    bool IsPaused() const { return control_.IsPaused(); }
+    bool IsCancelled() const { return control_.IsCancelled(); }
+    // The directory the library writes its output files to.
+    const QString& GetOutputDir() const {
+        return output_dir_;
+    }
+    // Digest of the model and the sinogram the restoration of `param`
+    // depends on.
+    static QByteArray GetRestorationKey(const ReconTaskParameter& param);
+    // Restores the slices `param` reconstructs, outside of any run, e.g. in
+    // an earlier pipeline stage. `key` is GetRestorationKey(param). The
+    // RestorationCache is asked first, and the network only runs on a miss.
+    // Returns null once `keep_going` returns false. Throws Ort::Exception if
+    // the model cannot be run.
+    static SharedRestoredSinogram Restore(const ReconTaskParameter& param, const QByteArray& key,
+                                          const std::function<bool()>& keep_going);
+    // Where the restored slices of `param` are saved, see
+    // ReconTaskParameter::restored_output.
+    static QString GetRestoredSinogramPath(const ReconTaskParameter& param, bool float32);
+    // Restored slices of an earlier run, reused if they cover the next one.
+    void SetRestoredSinogram(const SharedRestoredSinogram& restored) {
+        restored_ = restored;
+    }
+    // The restored slices of the last run, null without restoration.
+    const SharedRestoredSinogram& GetRestoredSinogram() const {
+        return restored_;
+    }
+    // Makes the next run take the slices found in a matching checkpoint
+    // instead of reconstructing them again.
+    void SetResumeFromCheckpoint(bool resume) {
+        resume_from_checkpoint_ = resume;
     }
-    std::vector<Tensor>& GetResultArray() {
+    const StageTimings& GetStageTimings() const {
+        return stage_timings_;
+    }
+    const Tensor& GetSinogramUsedToReconstruct() const {
+        return sinogram_used_to_reconstruct_;
+    }
+    // The snapshots of the last run, shared with whoever holds them.
+    const SharedTensorArray& GetResultArray() const {
         return result_array_;
     }
+    // Display images of the snapshots, rendered on the reconstruction thread.
+    const QVector<QImage>& GetResultImageArray() const {
+        return result_image_array_;
+    }
     const std::vector<int>& GetResultIterIndexArray() const {
         return result_iter_index_array_;
     }
+    // The final results of all reconstructed slices, shaped (num_slices,
+    // height, width). Empty unless the run was a volume reconstruction.
+    const Tensor& GetResultVolume() const {
+        return result_volume_;
+    }
 signals:
+    // Emitted from the reconstruction thread when the progress changes, at
+    // most once per display refresh.
     void Progress();
 protected:
     void run() override;
 
 private:
+    // One slice to be reconstructed by its own SPECTProject.
+    struct SliceJob {
+        int slice_index = 0;
+        std::vector<double> sinogram_data;
+        int progress = 0;
+        std::vector<std::vector<double> > recon_result_array;
+        // Taken from a checkpoint, nothing left to reconstruct.
+        bool done = false;
+    };
+    bool PrepareSliceJobs_();
     void Reconstruct();
+    void ReconstructSlice_(SliceJob& job) const;
+    // Digest of the inputs of `job` for the result cache.
+    QByteArray GetResultKey_(const SliceJob& job) const;
+    CheckpointHeader GetCheckpointHeader_() const;
+    // Queues the restored slices of the run for writing on the I/O thread.
+    void WriteRestoredSinogram_() const;
+    ReconTaskParameter param_;
+    QString output_dir_;
     SPECTParam spect_param_;
-    int progress_;
+    void PublishProgress_(int progress, qint64 elapsed_ms);
+    std::atomic<int> progress_{0};
+    std::atomic<qint64> ms_per_iteration_{0};
+    std::atomic<qint64> eta_ms_{-1};
+    int thread_budget_ = 0;
+    ReconControl control_;
+    QByteArray fingerprint_;
+    bool resume_from_checkpoint_ = false;
+    SharedRestoredSinogram restored_;
+    StageTimings stage_timings_;
+    Tensor sinogram_used_to_reconstruct_;
+
+    std::vector<SliceJob> slice_jobs_;
+    // The job whose snapshots are shown as the result of the task.
+    size_t index_display_job_ = 0;
 
-    std::vector<Tensor> result_array_;
+    SharedTensorArray result_array_;
+    QVector<QImage> result_image_array_;
     std::vector<int> result_iter_index_array_;
+    Tensor result_volume_;
 };
 
 #endif // RECONTHREAD_H
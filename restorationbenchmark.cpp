@@ -0,0 +1,262 @@
+#include "restorationbenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "ortsessioncache.h"
+#include "recontaskparameter.h"
+#include "scascnet.h"
+#include "sinogramadapter.h"
+#include "spectengine.h"
+#include "threadbudget.h"
+
+namespace {
+
+struct Result {
+    int num_threads = 0;
+    size_t batch_size = 0;
+    double load_ms = 0.;
+    double p50_ms = 0.;
+    double p95_ms = 0.;
+    double p99_ms = 0.;
+    double mean_ms = 0.;
+    double windows_per_second = 0.;
+    long peak_rss_kb = 0;
+};
+
+// Nearest-rank percentile of sorted `values`.
+double GetPercentile(const std::vector<double>& values, double percent)
+{
+    if (values.empty()) return 0.;
+    const size_t rank = static_cast<size_t>(std::ceil(percent / 100. * values.size()));
+    return values[std::min(values.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+// Peak resident memory of the process so far, 0 where not available.
+long GetPeakRssKb()
+{
+#ifdef WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+// Parses a comma-separated list of positive integers.
+bool ParseList(const QString& text, std::vector<int> *values)
+{
+    values->clear();
+    for (const QString& item: text.split(',', QString::SkipEmptyParts)) {
+        bool ok = false;
+        const int value = item.trimmed().toInt(&ok);
+        if (!ok || value <= 0) return false;
+        values->push_back(value);
+    }
+    return !values->empty();
+}
+
+// Fills `windows` with `num_windows` inputs for `net`, cut from the sinogram
+// of the task at `task_path` or random if the path is empty.
+bool MakeWindows(const Scascnet& net, const QString& task_path, size_t num_windows,
+                 std::vector<float> *windows)
+{
+    const size_t window_size = net.GetWindowSize();
+    windows->assign(num_windows * window_size, 0.f);
+    if (task_path.isEmpty()) {
+        std::mt19937 random_engine(0);
+        std::uniform_real_distribution<float> distribution(0.5f, 1.5f);
+        for (float& value: *windows) value = distribution(random_engine);
+        return true;
+    }
+    ReconTaskParameter param;
+    if (param.FromProtobufFilePath(task_path) != 0 || param.data->sinogram.shape().size() != 3) {
+        return false;
+    }
+    const std::vector<int>& shape = param.data->sinogram.shape();
+    const int depth = static_cast<int>(net.GetNumSlices());
+    SinogramAdapter adapter(shape[1], shape[2], static_cast<int>(net.GetNumAngles()),
+                            static_cast<int>(net.GetNumDetectors()));
+    const size_t slice_size = static_cast<size_t>(adapter.GetSliceSize());
+    const float *data = param.data->sinogram.GetFloat32Data();
+    // Windows are taken round-robin along the slices.
+    const int num_starts = std::max(1, shape[0] - depth + 1);
+    for (size_t w = 0; w < num_windows; ++w) {
+        const int start = static_cast<int>(w * depth) % num_starts;
+        float *dest = windows->data() + w * window_size;
+        for (int k = 0; k < depth && start + k < shape[0]; ++k) {
+            adapter.ToModel(data + (start + k) * slice_size, dest + k * adapter.GetModelSliceSize());
+        }
+    }
+    return true;
+}
+
+QJsonObject ToJson(const Result& result)
+{
+    QJsonObject object;
+    object["num_threads"] = result.num_threads;
+    object["batch_size"] = static_cast<int>(result.batch_size);
+    object["load_ms"] = result.load_ms;
+    object["p50_ms"] = result.p50_ms;
+    object["p95_ms"] = result.p95_ms;
+    object["p99_ms"] = result.p99_ms;
+    object["mean_ms"] = result.mean_ms;
+    object["windows_per_second"] = result.windows_per_second;
+    object["peak_rss_kb"] = static_cast<double>(result.peak_rss_kb);
+    return object;
+}
+
+} // namespace
+
+int RunRestorationBenchmark(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures the inference latency of the restoration model.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("benchmark-restoration", "Run the restoration benchmark."));
+    QCommandLineOption threads_option("threads", "Comma-separated intra-op thread counts.", "list",
+                                      QString::number(GetHardwareThreadCount()));
+    parser.addOption(threads_option);
+    QCommandLineOption batch_option("batch-sizes", "Comma-separated batch sizes.", "list", "1");
+    parser.addOption(batch_option);
+    QCommandLineOption warmup_option("warmup", "Untimed runs per setting.", "n", "3");
+    parser.addOption(warmup_option);
+    QCommandLineOption runs_option("runs", "Timed runs per setting.", "n", "50");
+    parser.addOption(runs_option);
+    QCommandLineOption task_option("task", "Take the inputs from the sinogram of this task "
+                                   "instead of random data.", "file");
+    parser.addOption(task_option);
+    QCommandLineOption json_option("json", "Write the results to this JSON file.", "file");
+    parser.addOption(json_option);
+    parser.addPositionalArgument("model", "The restoration model.", "<model>");
+    parser.process(arguments);
+
+    std::vector<int> thread_counts;
+    std::vector<int> batch_sizes;
+    bool ok_warmup = false;
+    bool ok_runs = false;
+    const int num_warmup = parser.value(warmup_option).toInt(&ok_warmup);
+    const int num_runs = parser.value(runs_option).toInt(&ok_runs);
+    if (!ParseList(parser.value(threads_option), &thread_counts)
+            || !ParseList(parser.value(batch_option), &batch_sizes)
+            || !ok_warmup || num_warmup < 0 || !ok_runs || num_runs <= 0) {
+        std::cerr << "Invalid benchmark settings." << std::endl;
+        return 2;
+    }
+    if (parser.positionalArguments().size() != 1) {
+        std::cerr << "Exactly one model must be given." << std::endl;
+        return 2;
+    }
+    const QString model_path = parser.positionalArguments().front();
+    const QString task_path = parser.value(task_option);
+
+    std::cout << std::setw(8) << "threads" << std::setw(7) << "batch"
+              << std::setw(11) << "load ms" << std::setw(10) << "p50 ms"
+              << std::setw(10) << "p95 ms" << std::setw(10) << "p99 ms"
+              << std::setw(12) << "windows/s" << std::setw(14) << "peak RSS kB" << std::endl;
+    std::vector<Result> results;
+    const int max_batch_size = *std::max_element(batch_sizes.cbegin(), batch_sizes.cend());
+    for (int num_threads: thread_counts) {
+        try {
+            // One fresh session per thread count, shared by the batch sizes.
+            OrtSessionCache cache;
+            SessionConfig config = SpectEngine::Instance().GetSessionCache().GetDefaultConfig();
+            config.intra_op_num_threads = num_threads;
+            config.cache_optimized_model = false;
+            QElapsedTimer timer;
+            timer.start();
+            Scascnet net(cache.Acquire(model_path, config), static_cast<size_t>(max_batch_size));
+            const double load_ms = timer.nsecsElapsed() / 1e6;
+
+            std::vector<float> input;
+            if (!MakeWindows(net, task_path, net.GetMaxBatchSize(), &input)) {
+                std::cerr << "No sinogram could be loaded from " << task_path.toStdString() << std::endl;
+                return 1;
+            }
+            std::vector<float> output(input.size());
+            for (int batch_size: batch_sizes) {
+                if (static_cast<size_t>(batch_size) > net.GetMaxBatchSize()) {
+                    std::cout << "Batch size " << batch_size << " skipped, the model takes at most "
+                              << net.GetMaxBatchSize() << "." << std::endl;
+                    continue;
+                }
+                for (int i = 0; i < num_warmup; ++i) {
+                    net.RunBatch(input.data(), batch_size, output.data());
+                }
+                std::vector<double> latencies;
+                QElapsedTimer total_timer;
+                total_timer.start();
+                for (int i = 0; i < num_runs; ++i) {
+                    timer.start();
+                    net.RunBatch(input.data(), batch_size, output.data());
+                    latencies.push_back(timer.nsecsElapsed() / 1e6);
+                }
+                const double total_ms = total_timer.nsecsElapsed() / 1e6;
+                std::sort(latencies.begin(), latencies.end());
+
+                Result result;
+                result.num_threads = num_threads;
+                result.batch_size = batch_size;
+                result.load_ms = load_ms;
+                result.p50_ms = GetPercentile(latencies, 50.);
+                result.p95_ms = GetPercentile(latencies, 95.);
+                result.p99_ms = GetPercentile(latencies, 99.);
+                result.mean_ms = std::accumulate(latencies.cbegin(), latencies.cend(), 0.) / num_runs;
+                result.windows_per_second = total_ms > 0. ? 1e3 * num_runs * batch_size / total_ms : 0.;
+                result.peak_rss_kb = GetPeakRssKb();
+                results.push_back(result);
+                std::cout << std::fixed << std::setprecision(2)
+                          << std::setw(8) << num_threads << std::setw(7) << batch_size
+                          << std::setw(11) << result.load_ms << std::setw(10) << result.p50_ms
+                          << std::setw(10) << result.p95_ms << std::setw(10) << result.p99_ms
+                          << std::setw(12) << result.windows_per_second
+                          << std::setw(14) << result.peak_rss_kb << std::endl;
+            }
+        } catch (const Ort::Exception& e) {
+            std::cerr << num_threads << " thread(s) failed: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    const QString json_path = parser.value(json_option);
+    if (!json_path.isEmpty()) {
+        QJsonArray array;
+        for (const Result& result: results) array.append(ToJson(result));
+        QJsonObject root;
+        root["model"] = model_path;
+        root["input"] = task_path.isEmpty() ? QString("synthetic") : task_path;
+        root["warmup"] = num_warmup;
+        root["runs"] = num_runs;
+        root["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+        root["results"] = array;
+        QFile file(json_path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)
+                || file.write(QJsonDocument(root).toJson()) < 0) {
+            std::cerr << "Cannot write " << json_path.toStdString() << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
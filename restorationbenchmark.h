@@ -0,0 +1,14 @@
+#ifndef RESTORATIONBENCHMARK_H
+#define RESTORATIONBENCHMARK_H
+
+#include <QStringList>
+
+// Entry point of `--benchmark-restoration`. Loads the restoration model once
+// per thread count, and for every batch size runs warm-up and then timed
+// inferences on synthetic windows or on windows cut from a task's sinogram.
+// Prints the p50/p95/p99 latency, throughput and peak memory of every
+// setting and optionally writes them as JSON. Returns the process exit
+// code.
+int RunRestorationBenchmark(const QStringList& arguments);
+
+#endif // RESTORATIONBENCHMARK_H
@@ -0,0 +1,143 @@
+#include "restorationcache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+namespace {
+
+const quint32 kKeyFileMagic = 0x53525253; // "SRRS"
+const quint32 kKeyFileVersion = 1;
+
+} // namespace
+
+RestorationCache::RestorationCache(qint64 max_bytes):
+    max_bytes_(max_bytes)
+{
+}
+
+SharedRestoredSinogram RestorationCache::Lookup(const QByteArray &key, int slice_begin, int slice_end)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if ((*it)->Covers(key, slice_begin, slice_end)) {
+            ++num_hits_;
+            entries_.splice(entries_.begin(), entries_, it);
+            return entries_.front();
+        }
+    }
+    ++num_misses_;
+    return nullptr;
+}
+
+void RestorationCache::Insert(const SharedRestoredSinogram &restored)
+{
+    if (!restored) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    // An entry covered by the new one is dropped.
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (restored->Covers((*it)->key, (*it)->slice_begin, (*it)->slice_end)) {
+            bytes_ -= GetBytes_(**it);
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    entries_.push_front(restored);
+    bytes_ += GetBytes_(*restored);
+    while (bytes_ > max_bytes_ && !entries_.empty()) {
+        bytes_ -= GetBytes_(*entries_.back());
+        entries_.pop_back();
+    }
+}
+
+QByteArray RestorationCache::GetFileDigest(const QString &path)
+{
+    QFileInfo info(path);
+    const QString identity = QString("%1|%2|%3").arg(info.canonicalFilePath())
+            .arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch());
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = file_digests_.find(identity);
+        if (it != file_digests_.end()) return it->second;
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    QFile file(path);
+    if (file.open(QIODevice::ReadOnly)) hash.addData(&file);
+    const QByteArray digest = hash.result();
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_digests_[identity] = digest;
+    return digest;
+}
+
+bool RestorationCache::ReadKeyFile_(const QString &data_path, int element_size,
+                                    const QByteArray &key, int slice_begin, int slice_end,
+                                    KeyFile *key_file)
+{
+    QFile file(GetKeyPath(data_path));
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version >> key_file->key >> key_file->slice_begin >> key_file->slice_end
+           >> key_file->num_slices >> key_file->num_angles >> key_file->num_detectors;
+    if (stream.status() != QDataStream::Ok || magic != kKeyFileMagic || version != kKeyFileVersion
+            || key_file->key != key || key_file->slice_begin > slice_begin
+            || key_file->slice_end < slice_end || key_file->slice_begin < 0
+            || key_file->slice_end > key_file->num_slices
+            || key_file->slice_begin >= key_file->slice_end) {
+        return false;
+    }
+    return QFileInfo(data_path).size() == key_file->GetNumValues() * element_size;
+}
+
+bool RestorationCache::FileHolds(const QString &data_path, int element_size, const QByteArray &key,
+                                 int slice_begin, int slice_end)
+{
+    KeyFile key_file;
+    return ReadKeyFile_(data_path, element_size, key, slice_begin, slice_end, &key_file);
+}
+
+SharedRestoredSinogram RestorationCache::ReadFile(const QString &data_path, const QByteArray &key,
+                                                  int slice_begin, int slice_end)
+{
+    KeyFile key_file;
+    if (!ReadKeyFile_(data_path, sizeof(double), key, slice_begin, slice_end, &key_file)) {
+        return nullptr;
+    }
+    QFile data_file(data_path);
+    if (!data_file.open(QIODevice::ReadOnly)) return nullptr;
+    auto restored = std::make_shared<RestoredSinogram>();
+    restored->key = key;
+    restored->slice_begin = key_file.slice_begin;
+    restored->slice_end = key_file.slice_end;
+    restored->sinogram = Tensor({key_file.num_slices, key_file.num_angles, key_file.num_detectors});
+    const qint64 slice_size = static_cast<qint64>(key_file.num_angles) * key_file.num_detectors;
+    const qint64 num_bytes = key_file.GetNumValues() * static_cast<qint64>(sizeof(double));
+    char *dest = reinterpret_cast<char *>(restored->sinogram.data().data()
+                                          + key_file.slice_begin * slice_size);
+    if (data_file.read(dest, num_bytes) != num_bytes) return nullptr;
+    return restored;
+}
+
+bool RestorationCache::WriteKeyFile(const QString &data_path, const RestoredSinogram &restored,
+                                    int slice_begin, int slice_end)
+{
+    const std::vector<int>& shape = restored.sinogram.shape();
+    QSaveFile file(GetKeyPath(data_path));
+    if (shape.size() != 3 || !file.open(QIODevice::WriteOnly)) return false;
+    QDataStream stream(&file);
+    stream << kKeyFileMagic << kKeyFileVersion << restored.key
+           << static_cast<qint32>(slice_begin) << static_cast<qint32>(slice_end)
+           << static_cast<qint32>(shape[0]) << static_cast<qint32>(shape[1])
+           << static_cast<qint32>(shape[2]);
+    return file.commit();
+}
+
+qint64 RestorationCache::GetBytes_(const RestoredSinogram &restored)
+{
+    return static_cast<qint64>(restored.sinogram.data().size() * sizeof(double));
+}
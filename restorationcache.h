@@ -0,0 +1,101 @@
+#ifndef RESTORATIONCACHE_H
+#define RESTORATIONCACHE_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <QByteArray>
+#include <QString>
+
+#include "tensor.h"
+
+// Slices [slice_begin, slice_end) of a sinogram after restoration; the
+// others are zero. `key` digests everything the restoration depends on.
+struct RestoredSinogram {
+    QByteArray key;
+    int slice_begin = 0;
+    int slice_end = 0;
+    Tensor sinogram;
+
+    bool Covers(const QByteArray& key, int slice_begin, int slice_end) const {
+        return this->key == key && this->slice_begin <= slice_begin && this->slice_end >= slice_end;
+    }
+};
+typedef std::shared_ptr<const RestoredSinogram> SharedRestoredSinogram;
+
+// Restored sinograms kept across tasks and runs, so that runs differing only
+// in reconstruction parameters skip the network. Recently used ones are
+// held in memory up to a size cap; beyond that, the float64 .resd files the
+// runs write are read back, next to which a key file records what they
+// hold.
+class RestorationCache
+{
+public:
+    explicit RestorationCache(qint64 max_bytes);
+
+    // The cached restoration covering [slice_begin, slice_end) under `key`,
+    // or null.
+    SharedRestoredSinogram Lookup(const QByteArray& key, int slice_begin, int slice_end);
+    void Insert(const SharedRestoredSinogram& restored);
+    long long GetNumHits() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_hits_;
+    }
+    long long GetNumMisses() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_misses_;
+    }
+    // SHA-1 of the contents of the file at `path`, computed once for every
+    // path, size and modification time.
+    QByteArray GetFileDigest(const QString& path);
+
+    static QString GetKeyPath(const QString& data_path) {
+        return data_path + ".key";
+    }
+    // Whether the raw file at `data_path`, of `element_size` bytes per
+    // value, holds [slice_begin, slice_end) restored under `key`, as its key
+    // file says.
+    static bool FileHolds(const QString& data_path, int element_size, const QByteArray& key,
+                          int slice_begin, int slice_end);
+    // Reads the .resd file at `data_path` if its key file says that it holds
+    // [slice_begin, slice_end) restored under `key`.
+    static SharedRestoredSinogram ReadFile(const QString& data_path, const QByteArray& key,
+                                           int slice_begin, int slice_end);
+    // Records that the .resd or .resf file at `data_path` holds slices
+    // [slice_begin, slice_end) of `restored`.
+    static bool WriteKeyFile(const QString& data_path, const RestoredSinogram& restored,
+                             int slice_begin, int slice_end);
+
+private:
+    struct KeyFile {
+        QByteArray key;
+        qint32 slice_begin = 0;
+        qint32 slice_end = 0;
+        qint32 num_slices = 0;
+        qint32 num_angles = 0;
+        qint32 num_detectors = 0;
+
+        qint64 GetNumValues() const {
+            return static_cast<qint64>(slice_end - slice_begin) * num_angles * num_detectors;
+        }
+    };
+    // Reads the key file of `data_path` and checks that it describes
+    // [slice_begin, slice_end) under `key` and that the data file has the
+    // size it implies.
+    static bool ReadKeyFile_(const QString& data_path, int element_size, const QByteArray& key,
+                             int slice_begin, int slice_end, KeyFile *key_file);
+    static qint64 GetBytes_(const RestoredSinogram& restored);
+
+    mutable std::mutex mutex_;
+    qint64 max_bytes_;
+    qint64 bytes_ = 0;
+    // Most recently used first.
+    std::list<SharedRestoredSinogram> entries_;
+    std::map<QString, QByteArray> file_digests_;
+    long long num_hits_ = 0;
+    long long num_misses_ = 0;
+};
+
+#endif // RESTORATIONCACHE_H
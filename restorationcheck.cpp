@@ -0,0 +1,170 @@
+#include "restorationcheck.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFileInfo>
+
+#include "global_defs.h"
+#include "inferenceservice.h"
+#include "recontaskparameter.h"
+#include "sinogramrestorer.h"
+#include "spectengine.h"
+
+RestorationError RestorationError::Compare(const Tensor &reference, const Tensor &restored,
+                                           int slice_begin, int slice_end)
+{
+    assert(reference.shape() == restored.shape() && reference.shape().size() == 3);
+    const size_t slice_size = static_cast<size_t>(reference.shape()[1]) * reference.shape()[2];
+    const double *ref = reference.data().data() + slice_begin * slice_size;
+    const double *test = restored.data().data() + slice_begin * slice_size;
+    const size_t size = (slice_end - slice_begin) * slice_size;
+
+    RestorationError error;
+    double peak = 0.;
+    double sum_abs = 0.;
+    double sum_squares = 0.;
+    for (size_t i = 0; i < size; ++i) {
+        const double diff = std::abs(test[i] - ref[i]);
+        error.max_error = std::max(error.max_error, diff);
+        sum_abs += diff;
+        sum_squares += diff * diff;
+        peak = std::max(peak, std::abs(ref[i]));
+    }
+    if (size == 0) return error;
+    error.mean_error = sum_abs / size;
+    const double mse = sum_squares / size;
+    error.psnr = mse > 0. ? 10. * std::log10(peak * peak / mse)
+                          : std::numeric_limits<double>::infinity();
+    return error;
+}
+
+namespace {
+
+// Slices restored on their own, which must match the same slices of a
+// whole-volume restoration.
+const int kRangeCheckBegin = 20;
+const int kRangeCheckEnd = 30;
+
+// Restores slices [slice_begin, slice_end) of `sinogram` with the model at
+// `model_path`.
+Tensor Restore(const QString& model_path, const Tensor& sinogram, int slice_begin, int slice_end,
+               qint64 *elapsed_ms)
+{
+    std::shared_ptr<InferenceService> service =
+            SpectEngine::Instance().GetInferenceService(model_path);
+    SinogramRestorer restorer(*service, kRestorationOverlap);
+    Tensor restored;
+    QElapsedTimer timer;
+    timer.start();
+    restorer.Restore(sinogram, slice_begin, slice_end, &restored, []() { return true; });
+    *elapsed_ms = timer.elapsed();
+    return restored;
+}
+
+// Restores all slices of `sinogram`.
+Tensor Restore(const QString& model_path, const Tensor& sinogram, qint64 *elapsed_ms)
+{
+    return Restore(model_path, sinogram, 0, sinogram.shape()[0], elapsed_ms);
+}
+
+} // namespace
+
+int RunRestorationCheck(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compares a reduced-precision restoration model "
+                                     "with the FP32 one.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("check-restoration", "Run the restoration check."));
+    QCommandLineOption precision_option("precision", "The variant to check, fp16 or int8.",
+                                        "precision", "int8");
+    parser.addOption(precision_option);
+    QCommandLineOption psnr_option("min-psnr", "Lowest acceptable PSNR in dB.", "db", "40");
+    parser.addOption(psnr_option);
+    parser.addPositionalArgument("tasks", "The .task files whose sinograms are restored.",
+                                 "<task>...");
+    parser.process(arguments);
+
+    ReconTaskParameter::ModelPrecision precision;
+    const QString precision_name = parser.value(precision_option).toLower();
+    if (precision_name == "fp16") {
+        precision = ReconTaskParameter::ModelPrecision::ReconTaskParameterPB_ModelPrecision_MODEL_FP16;
+    } else if (precision_name == "int8") {
+        precision = ReconTaskParameter::ModelPrecision::ReconTaskParameterPB_ModelPrecision_MODEL_INT8;
+    } else {
+        std::cerr << "Invalid precision: " << precision_name.toStdString() << std::endl;
+        return 2;
+    }
+    bool ok = false;
+    const double min_psnr = parser.value(psnr_option).toDouble(&ok);
+    if (!ok) {
+        std::cerr << "Invalid PSNR threshold: " << parser.value(psnr_option).toStdString() << std::endl;
+        return 2;
+    }
+    const QStringList task_paths = parser.positionalArguments();
+    if (task_paths.isEmpty()) {
+        std::cerr << "No task file given." << std::endl;
+        return 2;
+    }
+
+    int num_failed = 0;
+    for (const QString& task_path: task_paths) {
+        ReconTaskParameter param;
+        int rv = param.FromProtobufFilePath(task_path);
+        const Tensor& sinogram = param.data->sinogram;
+        if (rv != 0 || sinogram.shape().size() != 3) {
+            std::cerr << "[failed] " << task_path.toStdString() << ": no sinogram could be loaded."
+                      << std::endl;
+            ++num_failed;
+            continue;
+        }
+        const QString variant_path = ReconTaskParameter::GetModelPath(param.path_model, precision);
+        if (!QFileInfo::exists(variant_path)) {
+            std::cerr << "[failed] " << task_path.toStdString() << ": "
+                      << variant_path.toStdString() << " not found." << std::endl;
+            ++num_failed;
+            continue;
+        }
+        try {
+            qint64 reference_ms = 0;
+            qint64 variant_ms = 0;
+            const Tensor reference = Restore(param.path_model, sinogram, &reference_ms);
+            const Tensor restored = Restore(variant_path, sinogram, &variant_ms);
+            const RestorationError error = RestorationError::Compare(
+                        reference, restored, 0, sinogram.shape()[0]);
+            // The restoration of a slice must not depend on the range it is
+            // requested in, or cached restorations would differ by history.
+            const int range_begin = std::min(kRangeCheckBegin, sinogram.shape()[0] - 1);
+            const int range_end = std::min(kRangeCheckEnd, sinogram.shape()[0]);
+            qint64 range_ms = 0;
+            const Tensor range_restored = Restore(param.path_model, sinogram, range_begin, range_end,
+                                                  &range_ms);
+            const RestorationError range_error = RestorationError::Compare(
+                        reference, range_restored, range_begin, range_end);
+            const bool range_passed = range_error.max_error <= 1e-6 * reference.GetMaximum();
+            if (!range_passed) {
+                std::cout << "[failed] " << task_path.toStdString() << ": slices " << range_begin
+                          << "-" << range_end - 1 << " restored alone differ by up to "
+                          << range_error.max_error << " from the whole volume." << std::endl;
+            }
+            const bool passed = error.psnr >= min_psnr && range_passed;
+            if (!passed) ++num_failed;
+            std::cout << (passed ? "[passed] " : "[failed] ") << task_path.toStdString()
+                      << ": max error " << error.max_error
+                      << ", mean error " << error.mean_error
+                      << ", PSNR " << error.psnr << " dB"
+                      << ", FP32 " << reference_ms << " ms"
+                      << ", " << precision_name.toUpper().toStdString() << " " << variant_ms
+                      << " ms." << std::endl;
+        } catch (const Ort::Exception& e) {
+            std::cerr << "[failed] " << task_path.toStdString() << ": " << e.what() << std::endl;
+            ++num_failed;
+        }
+    }
+    return num_failed > 0 ? 1 : 0;
+}
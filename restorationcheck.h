@@ -0,0 +1,30 @@
+#ifndef RESTORATIONCHECK_H
+#define RESTORATIONCHECK_H
+
+#include <QStringList>
+
+#include "tensor.h"
+
+// Deviation of a restored sinogram from the reference restoration.
+struct RestorationError {
+    double max_error = 0.;
+    double mean_error = 0.;
+    // Peak signal-to-noise ratio in dB, with the largest magnitude of the
+    // reference as the peak. Infinite if both agree exactly.
+    double psnr = 0.;
+
+    // Compares slices [slice_begin, slice_end) of two tensors of the same
+    // shape.
+    static RestorationError Compare(const Tensor& reference, const Tensor& restored,
+                                    int slice_begin, int slice_end);
+};
+
+// Entry point of `--check-restoration`. Restores the sinograms of the given
+// .task files with the FP32 model and with a reduced-precision variant,
+// prints the error of the variant and its speed-up, and checks that slices
+// restored alone match those of the whole volume. Returns 1 if the PSNR of
+// any task falls below the threshold or the slices differ, 2 on bad
+// arguments and 0 otherwise.
+int RunRestorationCheck(const QStringList& arguments);
+
+#endif // RESTORATIONCHECK_H
@@ -0,0 +1,151 @@
+#include "resultcache.h"
+
+#include <algorithm>
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+namespace {
+
+const quint32 kResultCacheMagic = 0x53524343; // "SRCC"
+const quint32 kResultCacheVersion = 1;
+
+} // namespace
+
+ResultCache::ResultCache(const QString &dir, qint64 max_bytes):
+    dir_(dir),
+    max_bytes_(max_bytes)
+{
+    QDir().mkpath(dir_);
+    // Entries left by earlier sessions are indexed once.
+    const QFileInfoList files = QDir(dir_).entryInfoList(QStringList() << "*.res", QDir::Files);
+    for (const auto& info: files) {
+        Entry& entry = entries_[info.fileName()];
+        entry.bytes = info.size();
+        entry.last_used = info.lastModified().toMSecsSinceEpoch();
+        bytes_ += entry.bytes;
+    }
+    RemoveFiles_(TakeVictims_());
+}
+
+QString ResultCache::GetPath_(const QByteArray &key) const
+{
+    return QDir(dir_).filePath(QString::fromLatin1(key.toHex()) + ".res");
+}
+
+bool ResultCache::Lookup(const QByteArray &key, std::vector<std::vector<double> > *snapshots)
+{
+    const QString path = GetPath_(key);
+    const QString name = QFileInfo(path).fileName();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entries_.count(name) == 0) {
+            ++num_misses_;
+            return false;
+        }
+    }
+    QFile file(path);
+    bool ok = file.open(QIODevice::ReadOnly);
+    quint32 header[3] = {0, 0, 0};
+    ok = ok && file.read(reinterpret_cast<char *>(header), sizeof(header)) == sizeof(header)
+            && header[0] == kResultCacheMagic && header[1] == kResultCacheVersion;
+    std::vector<std::vector<double> > result(ok ? header[2] : 0);
+    for (auto& snapshot: result) {
+        quint64 size = 0;
+        ok = file.read(reinterpret_cast<char *>(&size), sizeof(size)) == sizeof(size)
+                && size * sizeof(double) <= static_cast<quint64>(file.size());
+        if (!ok) break;
+        snapshot.resize(size);
+        const qint64 num_bytes = static_cast<qint64>(size * sizeof(double));
+        ok = file.read(reinterpret_cast<char *>(snapshot.data()), num_bytes) == num_bytes;
+        if (!ok) break;
+    }
+    if (ok) {
+        // The modification time carries the recency over to later sessions.
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    }
+    file.close();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(name);
+    if (!ok) {
+        // Truncated or stale entries are dropped.
+        if (it != entries_.end()) {
+            bytes_ -= it->second.bytes;
+            entries_.erase(it);
+        }
+        QFile::remove(path);
+        ++num_misses_;
+        return false;
+    }
+    if (it != entries_.end()) it->second.last_used = QDateTime::currentMSecsSinceEpoch();
+    ++num_hits_;
+    *snapshots = std::move(result);
+    return true;
+}
+
+void ResultCache::Store(const QByteArray &key, const std::vector<std::vector<double> > &snapshots)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (max_bytes_ <= 0) return;
+    }
+    // Written aside and renamed, so readers never see half an entry.
+    const QString path = GetPath_(key);
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) return;
+    const quint32 header[3] = {kResultCacheMagic, kResultCacheVersion,
+                               static_cast<quint32>(snapshots.size())};
+    qint64 num_bytes = file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    for (const auto& snapshot: snapshots) {
+        const quint64 size = snapshot.size();
+        num_bytes += file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        num_bytes += file.write(reinterpret_cast<const char *>(snapshot.data()),
+                                static_cast<qint64>(size * sizeof(double)));
+    }
+    if (!file.commit()) return;
+
+    QStringList victims;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Entry& entry = entries_[QFileInfo(path).fileName()];
+        bytes_ += num_bytes - entry.bytes;
+        entry.bytes = num_bytes;
+        entry.last_used = QDateTime::currentMSecsSinceEpoch();
+        victims = TakeVictims_();
+    }
+    RemoveFiles_(victims);
+}
+
+QStringList ResultCache::TakeVictims_()
+{
+    QStringList victims;
+    while (bytes_ > max_bytes_ && !entries_.empty()) {
+        auto oldest = std::min_element(entries_.begin(), entries_.end(),
+                                       [](const std::pair<const QString, Entry>& a,
+                                          const std::pair<const QString, Entry>& b) {
+            return a.second.last_used < b.second.last_used;
+        });
+        victims << QDir(dir_).filePath(oldest->first);
+        bytes_ -= oldest->second.bytes;
+        entries_.erase(oldest);
+    }
+    return victims;
+}
+
+void ResultCache::RemoveFiles_(const QStringList &paths)
+{
+    for (const QString& path: paths) QFile::remove(path);
+}
+
+void ResultCache::AddFileIdentity(QCryptographicHash &hash, const QString &path)
+{
+    if (path.isEmpty()) return;
+    QFileInfo info(path);
+    const QString identity = QString("%1|%2|%3").arg(info.canonicalFilePath())
+            .arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch());
+    hash.addData(identity.toUtf8());
+}
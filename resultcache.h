@@ -0,0 +1,63 @@
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QString>
+#include <QStringList>
+
+// On-disk store of the snapshots of reconstructed slices, keyed by a digest
+// of everything the reconstruction depends on. The least recently used
+// entries are evicted once the cache grows beyond its size cap. Sizes and
+// recency are tracked in memory, and files are read and written outside
+// the lock, so that parallel slice workers do not wait for each other's
+// I/O.
+class ResultCache
+{
+public:
+    ResultCache(const QString& dir, qint64 max_bytes);
+
+    // Fills `snapshots` and returns true if `key` is cached.
+    bool Lookup(const QByteArray& key, std::vector<std::vector<double> > *snapshots);
+    void Store(const QByteArray& key, const std::vector<std::vector<double> >& snapshots);
+    long long GetNumHits() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_hits_;
+    }
+    long long GetNumMisses() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_misses_;
+    }
+
+    // Adds the identity of the file at `path`, i.e. its canonical path, size
+    // and modification time, to `hash`. Nothing is added for an empty path.
+    static void AddFileIdentity(QCryptographicHash& hash, const QString& path);
+
+private:
+    struct Entry {
+        qint64 bytes = 0;
+        // Milliseconds since the epoch of the last use.
+        qint64 last_used = 0;
+    };
+    QString GetPath_(const QByteArray& key) const;
+    // Drops least recently used entries from the index until the cache fits
+    // its cap and returns their paths, to be removed without the lock.
+    // Called with mutex_ held.
+    QStringList TakeVictims_();
+    static void RemoveFiles_(const QStringList& paths);
+
+    mutable std::mutex mutex_;
+    QString dir_;
+    qint64 max_bytes_;
+    // Keyed by file name.
+    std::map<QString, Entry> entries_;
+    qint64 bytes_ = 0;
+    long long num_hits_ = 0;
+    long long num_misses_ = 0;
+};
+
+#endif // RESULTCACHE_H
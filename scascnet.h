@@ -7,74 +7,141 @@
 #include <array>
 #include <utility>
 #include <assert.h>
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <numeric>
 
 #include <onnxruntime_cxx_api.h>
 #include "sinogram.h"
 
+// Restoration network. The I/O signature of the model is resolved once at
+// construction and inputs go through a buffer owned by the instance, so
+// repeated runs do not allocate. An instance is meant for one thread; the
+// session behind it may be shared.
 class Scascnet
 {
 public:
-    Scascnet(const ORTCHAR_T* model_path):
-        env_(ORT_LOGGING_LEVEL_WARNING, "Default"),
-        sess_options_(nullptr),
-        sess_(env_, model_path, sess_options_)
+    // `session` usually comes from OrtSessionCache and may be shared with
+    // other threads. `max_batch_size` caps the windows per run of models
+    // with a dynamic batch dimension.
+    explicit Scascnet(std::shared_ptr<Ort::Session> session, size_t max_batch_size = 1):
+        sess_(std::move(session)),
+        memory_info_(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)),
+        binding_(*sess_)
     {
-        std::cout << "Model built (Model path: " << model_path << ").\n";
-    }
-    Sinogram<float> Run(Sinogram<float> input)
-    {
-        input.L1NormalizeInPlace();
-        auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
-        size_t num_elements = num_slices_ * num_angles_ * num_detectors_;
-        std::array<int64_t, 4> input_shape{ 1, num_slices_, num_angles_, num_detectors_ };
-        auto input_tensor = Ort::Value::CreateTensor(
-            memory_info, input.GetData(), num_elements, input_shape.data(), input_shape.size());
-        assert(input_tensor.IsTensor());
-
-        std::vector<const char*> input_node_names(sess_.GetInputCount());
         Ort::AllocatorWithDefaultOptions allocator;
-        std::vector<int64_t> input_node_dims;
-        // iterate over all input nodes
-        for (size_t i = 0; i < input_node_names.size(); i++) {
-            // print input node names
-            char* input_name = sess_.GetInputName(i, allocator);
-            printf("Input %zu : name=%s\n", i, input_name);
-            input_node_names[i] = input_name;
+        for (size_t i = 0; i < sess_->GetInputCount(); ++i) {
+            char* name = sess_->GetInputName(i, allocator);
+            input_names_.emplace_back(name);
+            allocator.Free(name);
+        }
+        for (size_t i = 0; i < sess_->GetOutputCount(); ++i) {
+            char* name = sess_->GetOutputName(i, allocator);
+            output_names_.emplace_back(name);
+            allocator.Free(name);
+        }
+        assert(input_names_.size() == 1 && output_names_.size() == 1);
 
-            // print input node types
-            Ort::TypeInfo type_info = sess_.GetInputTypeInfo(i);
-            auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
+        // Dynamic dimensions keep the default window.
+        std::vector<int64_t> dims = sess_->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+        assert(dims.size() == shape_.size());
+        for (size_t i = 1; i < dims.size() && i < shape_.size(); ++i) {
+            if (dims[i] > 0) shape_[i] = dims[i];
+        }
+        max_batch_size_ = dims.size() > 0 && dims[0] > 0 ? static_cast<size_t>(dims[0])
+                                                         : std::max<size_t>(1, max_batch_size);
+        std::cout << "Model input " << input_names_[0] << ": " << shape_[1] << " x "
+                  << shape_[2] << " x " << shape_[3] << " (up to " << max_batch_size_
+                  << " per batch), output " << output_names_[0] << ".\n";
 
-            ONNXTensorElementDataType type = tensor_info.GetElementType();
-            printf("Input %zu : type=%d\n", i, type);
+        input_buffer_.resize(max_batch_size_ * GetWindowSize());
+        window_ptrs_.resize(max_batch_size_);
+    }
+    size_t GetNumSlices() const { return static_cast<size_t>(shape_[1]); }
+    size_t GetNumAngles() const { return static_cast<size_t>(shape_[2]); }
+    size_t GetNumDetectors() const { return static_cast<size_t>(shape_[3]); }
+    size_t GetMaxBatchSize() const { return max_batch_size_; }
+    // Elements of one window.
+    size_t GetWindowSize() const
+    {
+        return GetNumSlices() * GetNumAngles() * GetNumDetectors();
+    }
 
-            // print input shapes/dims
-            input_node_dims = tensor_info.GetShape();
-            printf("Input %zu : num_dims=%zu\n", i, input_node_dims.size());
-            for (size_t j = 0; j < input_node_dims.size(); j++)
-                printf("Input %zu : dim %zu=%jd\n", i, j, input_node_dims[j]);
+    // Restores `batch_size` consecutive windows of `input` into `output`.
+    void RunBatch(const float* input, size_t batch_size, float* output, double* norms = nullptr)
+    {
+        assert(batch_size > 0 && batch_size <= max_batch_size_);
+        for (size_t b = 0; b < batch_size; ++b) {
+            window_ptrs_[b] = input + b * GetWindowSize();
+        }
+        RunBatch(window_ptrs_.data(), batch_size, output, norms);
+    }
+    // Restores the windows at `windows[0..batch_size)`, which may lie
+    // anywhere, e.g. in the float32 view of a loaded sinogram, into
+    // consecutive windows of `output`. Every window is normalized to unit
+    // mean in one pass on its way into the bound buffer, which is the only
+    // copy of the input; its mean, or 1 if it is not positive, is stored in
+    // `norms` unless that is null.
+    // The model writes straight into `output`, and the bindings are only
+    // renewed when the output or the batch size changes.
+    void RunBatch(const float* const* windows, size_t batch_size, float* output, double* norms = nullptr)
+    {
+        assert(batch_size > 0 && batch_size <= max_batch_size_);
+        const size_t window_size = GetWindowSize();
+        for (size_t b = 0; b < batch_size; ++b) {
+            const float* window = windows[b];
+            const double mean = std::accumulate(window, window + window_size, 0.)
+                    / static_cast<double>(window_size);
+            // An empty window is passed through as it is.
+            const double norm = mean > 0. ? mean : 1.;
+            const float scale = static_cast<float>(1. / norm);
+            float* dest = input_buffer_.data() + b * window_size;
+            for (size_t i = 0; i < window_size; ++i) {
+                dest[i] = window[i] * scale;
+            }
+            if (norms) norms[b] = norm;
         }
-        std::vector<const char*> output_node_names(sess_.GetOutputCount());
-        for (size_t i = 0; i < output_node_names.size(); i++) {
-            output_node_names[i] = sess_.GetOutputName(i, allocator);
+        if (batch_size != bound_batch_size_ || output != bound_output_) {
+            std::array<int64_t, 4> shape = shape_;
+            shape[0] = static_cast<int64_t>(batch_size);
+            input_tensor_ = Ort::Value::CreateTensor<float>(
+                memory_info_, input_buffer_.data(), batch_size * window_size, shape.data(), shape.size());
+            output_tensor_ = Ort::Value::CreateTensor<float>(
+                memory_info_, output, batch_size * window_size, shape.data(), shape.size());
+            binding_.BindInput(input_names_[0].c_str(), input_tensor_);
+            binding_.BindOutput(output_names_[0].c_str(), output_tensor_);
+            bound_batch_size_ = batch_size;
+            bound_output_ = output;
         }
-        auto output_tensors = sess_.Run(Ort::RunOptions{ nullptr }, input_node_names.data(),
-            &input_tensor, input_node_names.size(),
-            output_node_names.data(), output_node_names.size());
-        assert(output_tensors.size() == 1 && output_tensors.front().IsTensor());
-        float* floatarr = output_tensors.front().GetTensorMutableData<float>();
-        return Sinogram<float>(std::vector<float>(
-            floatarr, floatarr + num_elements), 
-            num_slices_, num_angles_, num_detectors_);
+        sess_->Run(Ort::RunOptions{ nullptr }, binding_);
+    }
+    // Restores one window shaped like the model input into `output`.
+    void Run(const Sinogram<float>& input, Sinogram<float>* output)
+    {
+        assert(input.GetNumElements() == GetWindowSize() && output->GetNumElements() == GetWindowSize());
+        RunBatch(input.GetData(), 1, output->GetData());
+    }
+    Sinogram<float> Run(const Sinogram<float>& input)
+    {
+        Sinogram<float> output(GetNumSlices(), GetNumAngles(), GetNumDetectors());
+        Run(input, &output);
+        return output;
     }
 private:
-    Ort::Env env_;
-    Ort::SessionOptions sess_options_;
-    Ort::Session sess_;
-    int64_t num_slices_ = 16;
-    int64_t num_angles_ = 120;
-    int64_t num_detectors_ = 128;
+    std::shared_ptr<Ort::Session> sess_;
+    Ort::MemoryInfo memory_info_;
+    std::vector<std::string> input_names_;
+    std::vector<std::string> output_names_;
+    std::array<int64_t, 4> shape_{{ 1, 16, 120, 128 }};
+    size_t max_batch_size_ = 1;
+    std::vector<float> input_buffer_;
+    std::vector<const float*> window_ptrs_;
+    Ort::Value input_tensor_{ nullptr };
+    Ort::Value output_tensor_{ nullptr };
+    size_t bound_batch_size_ = 0;
+    const float* bound_output_ = nullptr;
+    Ort::IoBinding binding_;
 };
 
 
@@ -0,0 +1,156 @@
+#include "sessionbenchmark.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+
+#include "global_defs.h"
+#include "ortsessioncache.h"
+#include "scascnet.h"
+#include "threadbudget.h"
+
+namespace {
+
+struct Variant {
+    std::string name;
+    SessionConfig config;
+};
+
+std::vector<Variant> GetVariants(const SessionConfig& base)
+{
+    std::vector<Variant> variants;
+    variants.push_back({"configured", base});
+    const int num_threads = GetHardwareThreadCount();
+    for (int intra: {1, std::max(1, num_threads / 2), num_threads}) {
+        SessionConfig config = base;
+        config.intra_op_num_threads = intra;
+        variants.push_back({"intra=" + std::to_string(intra), config});
+    }
+    {
+        SessionConfig config = base;
+        config.parallel_execution = true;
+        config.inter_op_num_threads = 2;
+        variants.push_back({"parallel,inter=2", config});
+    }
+    for (int level = 0; level <= 3; ++level) {
+        SessionConfig config = base;
+        config.graph_optimization_level = level;
+        variants.push_back({"opt=" + std::to_string(level), config});
+    }
+    {
+        SessionConfig config = base;
+        config.enable_cpu_mem_arena = false;
+        variants.push_back({"no arena", config});
+    }
+    {
+        SessionConfig config = base;
+        config.enable_mem_pattern = false;
+        variants.push_back({"no mem pattern", config});
+    }
+    return variants;
+}
+
+// Milliseconds taken to load the model into an empty cache.
+double MeasureLoad(const QString& model_path, const QString& optimized_dir,
+                   const SessionConfig& config)
+{
+    OrtSessionCache cache(optimized_dir);
+    QElapsedTimer timer;
+    timer.start();
+    cache.Acquire(model_path, config);
+    return timer.nsecsElapsed() / 1e6;
+}
+
+} // namespace
+
+int RunSessionBenchmark(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures restoration model loading and inference "
+                                     "under different session options.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("benchmark-session", "Run the session benchmark."));
+    QCommandLineOption runs_option("runs", "Timed inference runs per setting.", "n", "20");
+    parser.addOption(runs_option);
+    QCommandLineOption config_option("config", "Session options to start from.", "file",
+                                     QDir(kBaseDir).filePath("onnx_session.json"));
+    parser.addOption(config_option);
+    parser.addPositionalArgument("model", "The restoration model.", "<model>");
+    parser.process(arguments);
+
+    bool ok = false;
+    const int num_runs = parser.value(runs_option).toInt(&ok);
+    if (!ok || num_runs <= 0) {
+        std::cerr << "Invalid number of runs: " << parser.value(runs_option).toStdString() << std::endl;
+        return 2;
+    }
+    if (parser.positionalArguments().size() != 1) {
+        std::cerr << "Exactly one model must be given." << std::endl;
+        return 2;
+    }
+    const QString model_path = parser.positionalArguments().front();
+    QTemporaryDir optimized_dir;
+    if (!optimized_dir.isValid()) {
+        std::cerr << "Cannot create a temporary directory." << std::endl;
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(18) << "setting"
+              << std::right << std::setw(12) << "load (ms)"
+              << std::setw(14) << "cached (ms)"
+              << std::setw(14) << "mean (ms)"
+              << std::setw(14) << "min (ms)" << std::endl;
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<float> distribution(0.5f, 1.5f);
+    for (const Variant& variant: GetVariants(SessionConfig::Load(parser.value(config_option)))) {
+        try {
+            SessionConfig uncached = variant.config;
+            uncached.cache_optimized_model = false;
+            SessionConfig cached = variant.config;
+            cached.cache_optimized_model = true;
+            const double load_ms = MeasureLoad(model_path, QString(), uncached);
+            // The first cached load writes the optimized model, the second
+            // one reads it.
+            MeasureLoad(model_path, optimized_dir.path(), cached);
+            const double cached_load_ms = MeasureLoad(model_path, optimized_dir.path(), cached);
+
+            OrtSessionCache cache;
+            Scascnet net(cache.Acquire(model_path, uncached), kRestorationMaxBatchSize);
+            const size_t batch_size = net.GetMaxBatchSize();
+            std::vector<float> input(batch_size * net.GetWindowSize());
+            std::vector<float> output(input.size());
+            for (float& value: input) value = distribution(random_engine);
+            // Warm-up runs size the arena and are not timed.
+            for (int i = 0; i < 2; ++i) {
+                net.RunBatch(input.data(), batch_size, output.data());
+            }
+            double total_ms = 0.;
+            double min_ms = 0.;
+            QElapsedTimer timer;
+            for (int i = 0; i < num_runs; ++i) {
+                timer.start();
+                net.RunBatch(input.data(), batch_size, output.data());
+                const double run_ms = timer.nsecsElapsed() / 1e6 / batch_size;
+                total_ms += run_ms;
+                min_ms = i == 0 ? run_ms : std::min(min_ms, run_ms);
+            }
+            std::cout << std::left << std::setw(18) << variant.name << std::right << std::fixed
+                      << std::setprecision(1) << std::setw(12) << load_ms
+                      << std::setw(14) << cached_load_ms
+                      << std::setw(14) << total_ms / num_runs
+                      << std::setw(14) << min_ms << std::endl;
+        } catch (const Ort::Exception& e) {
+            std::cout << std::left << std::setw(18) << variant.name << " failed: " << e.what() << std::endl;
+        }
+    }
+    std::cout << "Latencies are per window, in batches of up to "
+              << kRestorationMaxBatchSize << "." << std::endl;
+    return 0;
+}
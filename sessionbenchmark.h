@@ -0,0 +1,12 @@
+#ifndef SESSIONBENCHMARK_H
+#define SESSIONBENCHMARK_H
+
+#include <QStringList>
+
+// Entry point of `--benchmark-session`. Loads the restoration model with a
+// range of session options and prints the load time, with and without a
+// cached optimized model, and the inference latency of each. Returns the
+// process exit code.
+int RunSessionBenchmark(const QStringList& arguments);
+
+#endif // SESSIONBENCHMARK_H
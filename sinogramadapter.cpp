@@ -0,0 +1,131 @@
+#include "sinogramadapter.h"
+
+#include <algorithm>
+#include <cmath>
+
+SinogramAdapter::SinogramAdapter(int num_angles, int num_detectors, int model_angles, int model_detectors):
+    num_angles_(num_angles),
+    num_detectors_(num_detectors),
+    model_angles_(model_angles),
+    model_detectors_(model_detectors)
+{
+    if (num_detectors_ <= model_detectors_) {
+        detector_padding_ = (model_detectors_ - num_detectors_) / 2;
+    } else {
+        detectors_to_model_ = GetBinResampling(num_detectors_, model_detectors_);
+        detectors_from_model_ = GetBinResampling(model_detectors_, num_detectors_);
+    }
+    angles_to_model_ = GetPeriodicResampling(num_angles_, model_angles_);
+    angles_from_model_ = GetPeriodicResampling(model_angles_, num_angles_);
+    slice_buffer_.resize(static_cast<size_t>(std::max(num_angles_, model_angles_))
+                         * std::max(num_detectors_, model_detectors_));
+}
+
+SinogramAdapter::Resampling SinogramAdapter::GetBinResampling(int num_src, int num_dest)
+{
+    Resampling resampling;
+    const double scale = static_cast<double>(num_src) / num_dest;
+    for (int j = 0; j < num_dest; ++j) {
+        const double x = std::min(std::max((j + 0.5) * scale - 0.5, 0.), num_src - 1.);
+        const int lower = static_cast<int>(std::floor(x));
+        resampling.lower.push_back(lower);
+        resampling.upper.push_back(std::min(lower + 1, num_src - 1));
+        resampling.weights.push_back(static_cast<float>(x - lower));
+    }
+    return resampling;
+}
+
+SinogramAdapter::Resampling SinogramAdapter::GetPeriodicResampling(int num_src, int num_dest)
+{
+    Resampling resampling;
+    const double scale = static_cast<double>(num_src) / num_dest;
+    for (int j = 0; j < num_dest; ++j) {
+        const double x = j * scale;
+        const int lower = std::min(static_cast<int>(std::floor(x)), num_src - 1);
+        resampling.lower.push_back(lower);
+        resampling.upper.push_back((lower + 1) % num_src);
+        resampling.weights.push_back(static_cast<float>(x - lower));
+    }
+    return resampling;
+}
+
+void SinogramAdapter::ResampleRow(const float *src, const Resampling &resampling, float *dest)
+{
+    const int *lower = resampling.lower.data();
+    const int *upper = resampling.upper.data();
+    const float *weights = resampling.weights.data();
+    const int size = static_cast<int>(resampling.weights.size());
+    for (int j = 0; j < size; ++j) {
+        dest[j] = src[lower[j]] + weights[j] * (src[upper[j]] - src[lower[j]]);
+    }
+}
+
+void SinogramAdapter::ResampleRows(const float *src, int row_size, const Resampling &resampling,
+                                   float *dest)
+{
+    // Whole rows are blended, which keeps the inner loop contiguous.
+    const int num_rows = static_cast<int>(resampling.weights.size());
+    for (int j = 0; j < num_rows; ++j) {
+        const float *lower = src + static_cast<size_t>(resampling.lower[j]) * row_size;
+        const float *upper = src + static_cast<size_t>(resampling.upper[j]) * row_size;
+        const float weight = resampling.weights[j];
+        float *row = dest + static_cast<size_t>(j) * row_size;
+        for (int i = 0; i < row_size; ++i) {
+            row[i] = lower[i] + weight * (upper[i] - lower[i]);
+        }
+    }
+}
+
+void SinogramAdapter::DetectorsToModel_(const float *src, float *dest) const
+{
+    if (num_detectors_ <= model_detectors_) {
+        std::fill(dest, dest + model_detectors_, 0.f);
+        std::copy(src, src + num_detectors_, dest + detector_padding_);
+    } else {
+        ResampleRow(src, detectors_to_model_, dest);
+    }
+}
+
+void SinogramAdapter::DetectorsFromModel_(const float *src, float *dest) const
+{
+    if (num_detectors_ <= model_detectors_) {
+        std::copy(src + detector_padding_, src + detector_padding_ + num_detectors_, dest);
+    } else {
+        ResampleRow(src, detectors_from_model_, dest);
+    }
+}
+
+void SinogramAdapter::ToModel(const float *slice, float *model_slice)
+{
+    if (IsIdentity()) {
+        std::copy(slice, slice + GetSliceSize(), model_slice);
+        return;
+    }
+    // Detectors first, then whole rows across the angles.
+    for (int a = 0; a < num_angles_; ++a) {
+        DetectorsToModel_(slice + static_cast<size_t>(a) * num_detectors_,
+                          slice_buffer_.data() + static_cast<size_t>(a) * model_detectors_);
+    }
+    if (num_angles_ == model_angles_) {
+        std::copy(slice_buffer_.cbegin(), slice_buffer_.cbegin() + GetModelSliceSize(), model_slice);
+    } else {
+        ResampleRows(slice_buffer_.data(), model_detectors_, angles_to_model_, model_slice);
+    }
+}
+
+void SinogramAdapter::FromModel(const float *model_slice, float *slice)
+{
+    if (IsIdentity()) {
+        std::copy(model_slice, model_slice + GetSliceSize(), slice);
+        return;
+    }
+    const float *rows = model_slice;
+    if (num_angles_ != model_angles_) {
+        ResampleRows(model_slice, model_detectors_, angles_from_model_, slice_buffer_.data());
+        rows = slice_buffer_.data();
+    }
+    for (int a = 0; a < num_angles_; ++a) {
+        DetectorsFromModel_(rows + static_cast<size_t>(a) * model_detectors_,
+                            slice + static_cast<size_t>(a) * num_detectors_);
+    }
+}
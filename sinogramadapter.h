@@ -0,0 +1,61 @@
+#ifndef SINOGRAMADAPTER_H
+#define SINOGRAMADAPTER_H
+
+#include <vector>
+
+// Maps sinogram slices of any (num_angles, num_detectors) geometry onto the
+// fixed slice shape of the restoration network and back. Detector rows
+// narrower than the model are zero-padded on both sides, wider ones are
+// linearly resampled. Angles are resampled linearly over the full rotation.
+// The interpolation tables are built once, and the kernels run over
+// contiguous rows so that the compiler can vectorize them.
+class SinogramAdapter
+{
+public:
+    SinogramAdapter(int num_angles, int num_detectors, int model_angles, int model_detectors);
+
+    // True if the geometry already matches the model.
+    bool IsIdentity() const {
+        return num_angles_ == model_angles_ && num_detectors_ == model_detectors_;
+    }
+    int GetSliceSize() const { return num_angles_ * num_detectors_; }
+    int GetModelSliceSize() const { return model_angles_ * model_detectors_; }
+
+    // Maps a slice of the input geometry to one of the model.
+    void ToModel(const float* slice, float* model_slice);
+    // Maps a slice of the model back to the input geometry.
+    void FromModel(const float* model_slice, float* slice);
+
+private:
+    // Linear interpolation from one sampling of an axis to another:
+    // dest[j] = (1 - weights[j]) * src[lower[j]] + weights[j] * src[upper[j]].
+    struct Resampling {
+        std::vector<int> lower;
+        std::vector<int> upper;
+        std::vector<float> weights;
+    };
+    // Bins are aligned by their centres and clamped at the ends.
+    static Resampling GetBinResampling(int num_src, int num_dest);
+    // Samples cover a full rotation, so the last one wraps to the first.
+    static Resampling GetPeriodicResampling(int num_src, int num_dest);
+    static void ResampleRow(const float* src, const Resampling& resampling, float* dest);
+    static void ResampleRows(const float* src, int row_size, const Resampling& resampling,
+                             float* dest);
+    // Maps one row of detectors between the two widths.
+    void DetectorsToModel_(const float* src, float* dest) const;
+    void DetectorsFromModel_(const float* src, float* dest) const;
+
+    int num_angles_;
+    int num_detectors_;
+    int model_angles_;
+    int model_detectors_;
+    // Leading zero bins of a padded detector row.
+    int detector_padding_ = 0;
+    Resampling detectors_to_model_;
+    Resampling detectors_from_model_;
+    Resampling angles_to_model_;
+    Resampling angles_from_model_;
+    std::vector<float> slice_buffer_;
+};
+
+#endif // SINOGRAMADAPTER_H
@@ -0,0 +1,132 @@
+#include "sinogramrestorer.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "sinogramadapter.h"
+
+SinogramRestorer::SinogramRestorer(InferenceService &service, int overlap):
+    service_(service),
+    overlap_(std::max(0, std::min(overlap, static_cast<int>(service.GetNumSlices()) - 1)))
+{
+}
+
+std::vector<int> SinogramRestorer::GetWindowStarts(int num_slices, int slice_begin, int slice_end) const
+{
+    const int window = static_cast<int>(service_.GetNumSlices());
+    const int stride = window - overlap_;
+    const int last_start = std::max(0, num_slices - window);
+    std::vector<int> starts;
+    // Windows sit on a fixed grid, the last one moved back to end with the
+    // volume, and every window of it overlapping the range is taken, so a
+    // slice is restored the same way whatever range it is requested in.
+    const int first_covering = slice_begin - window + 1;
+    const int first = first_covering <= 0 ? 0 : (first_covering + stride - 1) / stride * stride;
+    for (int start = first; ; start += stride) {
+        const int clamped = std::min(start, last_start);
+        if (clamped >= slice_end) break;
+        if (starts.empty() || starts.back() != clamped) starts.push_back(clamped);
+        if (clamped == last_start) break;
+    }
+    return starts;
+}
+
+bool SinogramRestorer::Restore(const Tensor &sinogram, int slice_begin, int slice_end,
+                               Tensor *restored, const std::function<bool()> &keep_going)
+{
+    const std::vector<int>& shape = sinogram.shape();
+    assert(shape.size() == 3);
+    const int num_slices = shape[0];
+    const int window = static_cast<int>(service_.GetNumSlices());
+    const size_t slice_size = static_cast<size_t>(shape[1]) * shape[2];
+    const size_t window_size = service_.GetWindowSize();
+    SinogramAdapter adapter(shape[1], shape[2], static_cast<int>(service_.GetNumAngles()),
+                            static_cast<int>(service_.GetNumDetectors()));
+    const size_t model_slice_size = static_cast<size_t>(adapter.GetModelSliceSize());
+    assert(model_slice_size * window == window_size);
+    const size_t max_batch_size = service_.GetMaxBatchSize();
+    slice_begin = std::max(0, slice_begin);
+    slice_end = std::min(num_slices, slice_end);
+
+    input_.resize(max_batch_size * window_size);
+    output_.resize(max_batch_size * window_size);
+    norms_.resize(max_batch_size);
+    std::vector<float> slice_output(slice_size);
+    std::vector<double> weights(window);
+    for (int k = 0; k < window; ++k) {
+        weights[k] = std::min(k + 1, window - k);
+    }
+
+    *restored = Tensor(shape);
+    std::vector<double>& restored_data = restored->data();
+    // The float32 view of the sinogram is what the network reads from.
+    const float *data = sinogram.GetFloat32Data();
+    const std::vector<int> starts = GetWindowStarts(num_slices, slice_begin, slice_end);
+    // A window comes out at unit mean of its own input. It is taken back to
+    // the scale of that input and then to unit mean of the whole sinogram,
+    // which does not depend on the range restored.
+    const std::vector<double>& values = sinogram.data();
+    const double mean = values.empty() ? 0.
+            : std::accumulate(values.cbegin(), values.cend(), 0.) / values.size();
+    const double scale = mean > 0. ? 1. / mean : 1.;
+    // The weights are known beforehand, so that the blending can scale the
+    // outputs to their final values in the same pass.
+    std::vector<double> weight_sums(num_slices, 0.);
+    for (int start: starts) {
+        for (int slice = std::max(start, slice_begin); slice < std::min(start + window, slice_end); ++slice) {
+            weight_sums[slice] += weights[slice - start];
+        }
+    }
+
+    for (size_t first = 0; first < starts.size(); first += max_batch_size) {
+        if (!keep_going()) return false;
+        const size_t batch_size = std::min(max_batch_size, starts.size() - first);
+        std::vector<std::future<void> > results;
+        for (size_t b = 0; b < batch_size; ++b) {
+            const int start = starts[first + b];
+            const int num_valid = std::min(window, num_slices - start);
+            const float *src = data + start * slice_size;
+            float *output = output_.data() + b * window_size;
+            if (adapter.IsIdentity() && num_valid == window) {
+                // The window is read in place.
+                results.push_back(service_.Submit(src, output, &norms_[b]));
+                continue;
+            }
+            float *dest = input_.data() + b * window_size;
+            for (int k = 0; k < num_valid; ++k) {
+                adapter.ToModel(src + k * slice_size, dest + k * model_slice_size);
+            }
+            // Volumes thinner than a window are zero-padded.
+            std::fill(dest + num_valid * model_slice_size, dest + window_size, 0.f);
+            results.push_back(service_.Submit(dest, output, &norms_[b]));
+        }
+        // All windows are waited for before any error is raised, since the
+        // service reads and writes our buffers until then.
+        for (auto& result: results) {
+            result.wait();
+        }
+        for (auto& result: results) {
+            result.get();
+        }
+
+        for (size_t b = 0; b < batch_size; ++b) {
+            const int start = starts[first + b];
+            const int begin = std::max(start, slice_begin);
+            const int end = std::min(start + window, slice_end);
+            const float *window_output = output_.data() + b * window_size;
+            for (int slice = begin; slice < end; ++slice) {
+                const double weight = weights[slice - start] * norms_[b] * scale / weight_sums[slice];
+                const float *src = window_output + (slice - start) * model_slice_size;
+                if (!adapter.IsIdentity()) {
+                    adapter.FromModel(src, slice_output.data());
+                    src = slice_output.data();
+                }
+                double *dest = restored_data.data() + slice * slice_size;
+                for (size_t i = 0; i < slice_size; ++i) {
+                    dest[i] += weight * src[i];
+                }
+            }
+        }
+    }
+    return true;
+}
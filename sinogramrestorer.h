@@ -0,0 +1,43 @@
+#ifndef SINOGRAMRESTORER_H
+#define SINOGRAMRESTORER_H
+
+#include <functional>
+#include <vector>
+
+#include "inferenceservice.h"
+#include "tensor.h"
+
+// Restores a range of slices of a (num_slices, num_angles, num_detectors)
+// sinogram with the restoration network. The range is tiled into windows of
+// the model's depth that overlap by `overlap` slices, which go through the
+// shared InferenceService a batch at a time, so that they may be batched
+// with windows of other tasks. The overlapping outputs are blended with tent
+// weights that fall off towards the window borders. Every window is brought
+// to the same scale, that of the whole sinogram normalized to unit mean,
+// which is what a single restored window had before, so that slices from
+// different windows remain comparable. Slices of another geometry than the
+// model's go through a SinogramAdapter on the way in and out.
+class SinogramRestorer
+{
+public:
+    SinogramRestorer(InferenceService& service, int overlap);
+
+    // The first slices of the windows needed for [slice_begin, slice_end).
+    std::vector<int> GetWindowStarts(int num_slices, int slice_begin, int slice_end) const;
+
+    // Restores [slice_begin, slice_end) of `sinogram` into `restored`, which
+    // gets the shape of `sinogram`; slices outside the range are zero.
+    // `keep_going` is asked before every batch, and the restoration stops
+    // with false once it returns false.
+    bool Restore(const Tensor& sinogram, int slice_begin, int slice_end, Tensor *restored,
+                 const std::function<bool()>& keep_going);
+
+private:
+    InferenceService& service_;
+    int overlap_;
+    std::vector<float> input_;
+    std::vector<float> output_;
+    std::vector<double> norms_;
+};
+
+#endif // SINOGRAMRESTORER_H
@@ -1,4 +1,4 @@
-QT += core gui
+QT += core gui concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -36,6 +36,13 @@ USE_APPIMAGE = "no"
 equals(SPECT_USE_OMP, "yes") {
     SPECT_INCLUDE_DIR = $$SPECT_OMP_INCLUDE_DIR
     SPECT_LIB_DIR = $$SPECT_OMP_LIB_DIR
+    # Needed to budget the OpenMP threads of the library per reconstruction.
+    win32 {
+        QMAKE_CXXFLAGS += /openmp
+    } else {
+        QMAKE_CXXFLAGS += -fopenmp
+        QMAKE_LFLAGS += -fopenmp
+    }
 } else {
 equals(SPECT_USE_OMP, "no") {
     SPECT_INCLUDE_DIR = $$SPECT_NO_OMP_INCLUDE_DIR
@@ -120,33 +127,69 @@ INCLUDEPATH += \
     $${DCMTK_INCLUDE_DIR}
 
 SOURCES += \
+    batchrunner.cpp \
+    checkpoint.cpp \
+    inferenceservice.cpp \
+    iothread.cpp \
     main.cpp \
     mainwindow.cpp \
+    ortsessioncache.cpp \
     recontask.cpp \
     recontaskparameter.cpp \
     recontaskparameter.pb.cc \
+    reconscheduler.cpp \
     reconthread.cpp \
+    restorationbenchmark.cpp \
+    restorationcache.cpp \
+    restorationcheck.cpp \
+    resultcache.cpp \
+    sessionbenchmark.cpp \
     resultdialog.cpp \
     resultwindow.cpp \
     sinogramfilereader.cpp \
+    sinogramadapter.cpp \
+    sinogramrestorer.cpp \
+    spectengine.cpp \
+    sysmatprefetcher.cpp \
     tensor.cpp \
-    utils.cpp
+    utils.cpp \
+    volumerenderer.cpp \
+    volumeviewer.cpp
 
 HEADERS += \
+    batchrunner.h \
+    checkpoint.h \
     error_code.h \
     global_defs.h \
+    inferenceservice.h \
+    iothread.h \
     mainwindow.h \
+    ortsessioncache.h \
     recontask.h \
     recontaskparameter.h \
     recontaskparameter.pb.h \
+    reconcontrol.h \
+    reconscheduler.h \
     reconthread.h \
+    restorationbenchmark.h \
+    restorationcache.h \
+    restorationcheck.h \
+    resultcache.h \
+    sessionbenchmark.h \
     resultdialog.h \
     resultwindow.h \
     scascnet.h \
     sinogram.h \
     sinogramfilereader.h \
+    sinogramadapter.h \
+    sinogramrestorer.h \
+    spectengine.h \
+    sysmatprefetcher.h \
     tensor.h \
-    utils.h
+    threadbudget.h \
+    utils.h \
+    volumerenderer.h \
+    volumeviewer.h
 
 FORMS += \
     mainwindow.ui \
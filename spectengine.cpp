@@ -0,0 +1,91 @@
+#include "spectengine.h"
+
+#include <QDebug>
+#include <QDir>
+
+#include "global_defs.h"
+#include "inferenceservice.h"
+#include "ortsessioncache.h"
+#include "spect.h"
+#include "reconthread.h"
+#include "threadbudget.h"
+
+namespace {
+
+const qint64 kResultCacheMaxBytes = 1LL << 30;
+const qint64 kRestorationCacheMaxBytes = 512LL << 20;
+// Options of the restoration sessions, see SessionConfig.
+const char kSessionConfigFile[] = "onnx_session.json";
+
+} // namespace
+
+SpectEngine::SpectEngine():
+    result_cache_(QDir(kBaseDir).filePath("cache/results"), kResultCacheMaxBytes),
+    session_cache_(new OrtSessionCache(QDir(kBaseDir).filePath("cache/models"))),
+    restoration_cache_(kRestorationCacheMaxBytes)
+{
+    SessionConfig config = SessionConfig::Load(QDir(kBaseDir).filePath(kSessionConfigFile));
+    restoration_threads_configured_ = config.intra_op_num_threads > 0;
+    // Every core until a scheduler or the batch runner sets a budget from
+    // the number of tasks running at a time.
+    if (!restoration_threads_configured_) config.intra_op_num_threads = GetHardwareThreadCount();
+    session_cache_->SetDefaultConfig(config);
+}
+
+void SpectEngine::SetDefaultRestorationThreads(int num_threads)
+{
+    if (restoration_threads_configured_) return;
+    SessionConfig config = session_cache_->GetDefaultConfig();
+    if (config.intra_op_num_threads == std::max(1, num_threads)) return;
+    config.intra_op_num_threads = std::max(1, num_threads);
+    session_cache_->SetDefaultConfig(config);
+    // The services hold the sessions of the previous budget; tasks running
+    // on them keep them until they are done.
+    std::lock_guard<std::mutex> lock(services_mutex_);
+    services_.clear();
+}
+
+SpectEngine::~SpectEngine()
+{
+    // Pending writes finish while the rest of the engine is still alive.
+    io_thread_.Flush();
+    // Services hold sessions, so they go before the session cache.
+    services_.clear();
+}
+
+SpectEngine& SpectEngine::Instance()
+{
+    static SpectEngine engine;
+    return engine;
+}
+
+ReconThread *SpectEngine::CreateWorker(QObject *parent)
+{
+    std::call_once(init_flag_, [this]() { Initialize_(); });
+    return new ReconThread(parent);
+}
+
+void SpectEngine::Initialize_()
+{
+    // 初始化内存全局变量
+    SPECTSetLogLevel(LOG_INFO, true);
+    init_status_ = SPECTInitialize();
+    if (0 != init_status_) {
+        qDebug() << __FUNCTION__ << ": ";
+        qDebug() << "Fail to init planning..., error:%s\n";
+        qDebug() << SPECTGetErrString((ERR_CODE)init_status_) << endl;
+    }
+}
+
+std::shared_ptr<InferenceService> SpectEngine::GetInferenceService(const QString &model_path)
+{
+    std::shared_ptr<Ort::Session> session = session_cache_->Acquire(model_path);
+    std::lock_guard<std::mutex> lock(services_mutex_);
+    std::shared_ptr<InferenceService>& service = services_[model_path];
+    // A reloaded model gets a new session and so a new service.
+    if (!service || !service->IsServing(session)) {
+        service = std::make_shared<InferenceService>(session, kRestorationMaxBatchSize,
+                                                     kRestorationMaxDelayMs);
+    }
+    return service;
+}
@@ -0,0 +1,86 @@
+#ifndef SPECTENGINE_H
+#define SPECTENGINE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <QObject>
+#include <QString>
+
+#include "iothread.h"
+#include "restorationcache.h"
+#include "resultcache.h"
+#include "sysmatprefetcher.h"
+
+class InferenceService;
+class OrtSessionCache;
+class ReconThread;
+
+// Process-wide context of the reconstruction library. The library is
+// initialized once, on first use, and resources shared by all runs live
+// here. Workers are cheap and handed out on demand.
+class SpectEngine
+{
+public:
+    static SpectEngine& Instance();
+
+    // Returns the error code of the library initialization, 0 on success.
+    int GetInitStatus() const {
+        return init_status_;
+    }
+    // A new reconstruction worker owned by `parent`.
+    ReconThread *CreateWorker(QObject *parent);
+    // Reads system matrices ahead of the runs using them.
+    SysmatPrefetcher& GetSysmatPrefetcher() {
+        return sysmat_prefetcher_;
+    }
+    // Reconstructed slices memoized across runs and sessions.
+    ResultCache& GetResultCache() {
+        return result_cache_;
+    }
+    // Restoration models loaded once per process.
+    OrtSessionCache& GetSessionCache() {
+        return *session_cache_;
+    }
+    // Restored sinograms reused by runs over the same inputs.
+    RestorationCache& GetRestorationCache() {
+        return restoration_cache_;
+    }
+    // Background thread for writes kept off the reconstruction, e.g. of
+    // restored sinograms.
+    IoThread& GetIoThread() {
+        return io_thread_;
+    }
+    // Threads of the restoration sessions unless onnx_session.json sets
+    // them, e.g. the thread budget of one task, so that restoration does
+    // not compete with the OpenMP threads of running reconstructions.
+    // Sessions are rebuilt with the new value on their next use.
+    void SetDefaultRestorationThreads(int num_threads);
+    // The service batching restoration windows of `model_path` across all
+    // running tasks, started on first use.
+    std::shared_ptr<InferenceService> GetInferenceService(const QString& model_path);
+
+private:
+    SpectEngine();
+    ~SpectEngine();
+    SpectEngine(const SpectEngine&) = delete;
+    SpectEngine& operator=(const SpectEngine&) = delete;
+    void Initialize_();
+
+    std::once_flag init_flag_;
+    int init_status_ = 0;
+    // Whether onnx_session.json sets intra_op_num_threads itself.
+    bool restoration_threads_configured_ = false;
+    SysmatPrefetcher sysmat_prefetcher_;
+    ResultCache result_cache_;
+    // Held by pointer to keep ONNX Runtime out of this header.
+    std::unique_ptr<OrtSessionCache> session_cache_;
+    std::mutex services_mutex_;
+    std::map<QString, std::shared_ptr<InferenceService> > services_;
+    RestorationCache restoration_cache_;
+    // Last, so that pending writes finish before anything else goes.
+    IoThread io_thread_;
+};
+
+#endif // SPECTENGINE_H
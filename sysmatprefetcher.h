@@ -0,0 +1,48 @@
+#ifndef SYSMATPREFETCHER_H
+#define SYSMATPREFETCHER_H
+
+#include <mutex>
+#include <set>
+
+#include <QString>
+
+// Warms the OS page cache with system matrix files before a run. The
+// library reads the matrix by path into its own buffer on every run, so
+// nothing is held here: the kernel is only asked to read the file ahead in
+// the background, so that the library's read is served from memory rather
+// than disk. The pages stay evictable, and no memory is added to the
+// process.
+class SysmatPrefetcher
+{
+public:
+    // Starts reading `path` ahead without waiting for it. Returns false if
+    // the file cannot be opened.
+    bool Prefetch(const QString& path);
+
+    // Requests for a file seen before, i.e. likely in the page cache
+    // already, and for new files.
+    long long GetNumRepeats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_repeats_;
+    }
+    long long GetNumFirsts() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_firsts_;
+    }
+    // Total size of the new files, i.e. the most the read-ahead may have
+    // brought into the page cache.
+    long long GetNumBytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_bytes_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    // Canonical paths and modification times of the files prefetched.
+    std::set<QString> seen_;
+    long long num_repeats_ = 0;
+    long long num_firsts_ = 0;
+    long long num_bytes_ = 0;
+};
+
+#endif // SYSMATPREFETCHER_H
@@ -15,7 +15,8 @@ void Tensor::ReadFromRawFile(const std::string &file_name, const std::vector<int
         assert (x > 0);
         num_elements *= x;
     }
-    data_.resize(num_elements);
+    data_ = std::make_shared<std::vector<DataType>>(num_elements);
+    ResetFloat32_();
     std::ifstream ifs(file_name, std::ios::binary);
     if (!ifs.is_open()) {
         std::cerr << "Failed to open file " << file_name << std::endl;
@@ -55,14 +56,14 @@ void Tensor::ReadFromRawFile(const std::string &file_name, const std::vector<int
         case FileDataType::kFloat32: {
             using Type = float;
             for (int i = 0; i < total_bytes_count; i += sizeof(Type)) {
-                data_[i / sizeof(Type)] = static_cast<double>(*reinterpret_cast<Type *>(buffer.data() + i));
+                (*data_)[i / sizeof(Type)] = static_cast<double>(*reinterpret_cast<Type *>(buffer.data() + i));
             }
             break;
         }
         case FileDataType::kFloat64: {
             using Type = double;
             for (int i = 0; i < total_bytes_count; i += sizeof(Type)) {
-                data_[i / sizeof(Type)] = static_cast<double>(*reinterpret_cast<Type *>(buffer.data() + i));
+                (*data_)[i / sizeof(Type)] = static_cast<double>(*reinterpret_cast<Type *>(buffer.data() + i));
             }
             break;
         }
@@ -117,13 +118,17 @@ Tensor Tensor::Permute(const std::vector<int> &p) const {
     for (size_t i = 0; i < shape_.size(); ++i) {
         result.shape_[i] = shape_[p[i]];
     }
+    // The buffers are taken once, so that the copy neither detaches nor
+    // touches the float32 mirror per element.
+    const std::vector<DataType>& src = data();
+    std::vector<DataType>& dest = result.data();
     TensorIndexIterator iterator(shape_);
     while (!iterator.end()) {
         const auto &index = iterator.index();
         for (size_t i = 0; i < shape_.size(); ++i) {
             p_index[i] = index[p[i]];
         }
-        result[p_index] = (*this)[index];
+        dest[result.GetIndex_(p_index)] = src[GetIndex_(index)];
         iterator.Next();
     }
     return result;
@@ -9,8 +9,12 @@
 #include <string>
 #include <iostream>
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <cassert>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 
 class Tensor {
 public:
@@ -29,6 +33,8 @@ public:
 
     typedef double DataType;
 
+    // The elements are held in a reference-counted buffer shared between
+    // copies; the buffer is only duplicated when a shared tensor is written.
     Tensor() {}
 
     static void CheckConsistency(const std::vector<int>& shape, int size)
@@ -50,23 +56,28 @@ public:
     {
         int num_elements = 1;
         for (auto s: shape) num_elements *= s;
-        data_.resize(num_elements);
+        data_ = std::make_shared<std::vector<DataType>>(num_elements);
+        ResetFloat32_();
     }
 
     Tensor(const std::vector<int> &shape, const std::vector<DataType> &data) : shape_(shape)
     {
         CheckConsistency(shape, static_cast<int>(data.size()));
-        data_ = data;
+        data_ = std::make_shared<std::vector<DataType>>(data);
+        ResetFloat32_();
     }
 
     Tensor(const std::vector<int> &shape, std::vector<DataType> &&data): shape_(shape)
     {
         CheckConsistency(shape, static_cast<int>(data.size()));
-        data_ = move(data);
+        data_ = std::make_shared<std::vector<DataType>>(std::move(data));
+        ResetFloat32_();
     }
 
-    Tensor(Tensor&& tensor): shape_(std::move(tensor.shape_)), data_(std::move(tensor.data_)) {}
-    Tensor(const Tensor& tensor): shape_(tensor.shape_), data_(tensor.data_) {}
+    Tensor(Tensor&& tensor): shape_(std::move(tensor.shape_)), data_(std::move(tensor.data_)),
+        float32_(std::move(tensor.float32_)) {}
+    Tensor(const Tensor& tensor): shape_(tensor.shape_), data_(tensor.data_),
+        float32_(tensor.float32_) {}
     Tensor& operator=(const Tensor& tensor) = default;
     Tensor& operator=(Tensor&& tensor) = default;
 
@@ -76,12 +87,23 @@ public:
     void Set(const std::vector<int>& shape, const std::vector<DataType>& data) {
         CheckConsistency(shape, static_cast<int>(data.size()));
         shape_ = shape;
-        data_ = data;
+        data_ = std::make_shared<std::vector<DataType>>(data);
+        ResetFloat32_();
     }
     void Set(const std::vector<int>& shape, std::vector<DataType>&& data) {
         CheckConsistency(shape, static_cast<int>(data.size()));
         shape_ = shape;
-        data_ = std::move(data);
+        data_ = std::make_shared<std::vector<DataType>>(std::move(data));
+        ResetFloat32_();
+    }
+    // Returns a tensor of a different shape viewing the same elements.
+    Tensor Reshape(const std::vector<int>& shape) const {
+        CheckConsistency(shape, static_cast<int>(data().size()));
+        Tensor result;
+        result.shape_ = shape;
+        result.data_ = data_;
+        result.float32_ = float32_;
+        return result;
     }
     enum class FileDataType {
         kFloat32,
@@ -110,42 +132,84 @@ public:
     }
 
     DataType &operator[](const std::vector<int> &index) {
-        return data_[GetIndex_(index)];
+        Detach_();
+        InvalidateFloat32_();
+        return (*data_)[GetIndex_(index)];
     }
 
     const DataType &operator[](const std::vector<int> &index) const {
-        return data_[GetIndex_(index)];
+        return data()[GetIndex_(index)];
     }
 
     Tensor Permute(const std::vector<int> &p) const;
     std::string ToString() const;
     const std::vector<DataType>& data() const {
-        return data_;
+        static const std::vector<DataType> kEmpty;
+        return data_ ? *data_ : kEmpty;
     }
+    // Mutable access detaches the tensor from any other tensor sharing its
+    // elements.
     std::vector<DataType>& data() {
-        return data_;
+        Detach_();
+        InvalidateFloat32_();
+        return *data_;
+    }
+    // The elements converted to float32, e.g. for the restoration network.
+    // The conversion is done once per buffer, on first use, and shared by
+    // every tensor sharing the elements. The pointer stays valid as long as
+    // the elements are neither written nor released.
+    const float *GetFloat32Data() const {
+        if (!float32_) return nullptr;
+        std::call_once(float32_->once, [this]() {
+            float32_->data.assign(data().cbegin(), data().cend());
+            float32_->ready = true;
+        });
+        return float32_->data.data();
     }
     DataType GetMaximum() const {
-        return *std::max_element(data_.cbegin(), data_.cend());
+        return *std::max_element(data().cbegin(), data().cend());
     }
     DataType GetMinimum() const {
-        return *std::min_element(data_.cbegin(), data_.cend());
+        return *std::min_element(data().cbegin(), data().cend());
     }
     DataType GetSum() const {
-        return std::accumulate(data_.cbegin(), data_.cend(), DataType(0));
+        return std::accumulate(data().cbegin(), data().cend(), DataType(0));
     }
     void NormalizeInPlace() {
         DataType min = GetMinimum();
-        for (auto& x: data_) {
+        std::vector<DataType>& values = data();
+        for (auto& x: values) {
             x -= min;
         }
         DataType max = GetMaximum();
         if (max < 1e-8) return;
-        for (auto& x: data_) {
+        for (auto& x: values) {
             x /= max;
         }
     }
 private:
+    struct Float32Mirror {
+        std::once_flag once;
+        std::vector<float> data;
+        std::atomic<bool> ready{false};
+    };
+    void ResetFloat32_() {
+        float32_ = std::make_shared<Float32Mirror>();
+    }
+    // Called before the elements are written. A mirror that is still empty
+    // and not shared with another tensor stays valid, so that writes element
+    // by element do not allocate.
+    void InvalidateFloat32_() {
+        if (!float32_ || float32_.use_count() > 1 || float32_->ready) ResetFloat32_();
+    }
+    void Detach_() {
+        if (!data_) {
+            data_ = std::make_shared<std::vector<DataType>>();
+        } else if (data_.use_count() > 1) {
+            data_ = std::make_shared<std::vector<DataType>>(*data_);
+        }
+    }
+
     void CheckIndex_(const std::vector<int> &index) const {
         assert (index.size() == shape_.size());
         for (size_t i = 0; i < shape_.size(); ++i) {
@@ -159,7 +223,7 @@ private:
         CheckIndex_();
 #endif
         size_t result = 0;
-        size_t curr = data_.size();
+        size_t curr = data().size();
         for (size_t i = 0; i < index.size(); ++i) {
             curr /= shape_[i];
             result += index[i] * curr;
@@ -169,7 +233,7 @@ private:
 
     std::vector<int> ToIndex(size_t index) {
         std::vector<int> result(shape_.size());
-        size_t curr = data_.size();
+        size_t curr = data().size();
         for (size_t i = 0; i < shape_.size(); ++i) {
             curr /= shape_[i];
             result[i] = index / curr;
@@ -179,8 +243,14 @@ private:
     }
 
     std::vector<int> shape_;
-    std::vector<DataType> data_;
+    std::shared_ptr<std::vector<DataType>> data_;
+    // Replaced on mutable access to data_ unless still empty and unshared.
+    std::shared_ptr<Float32Mirror> float32_;
 };
 
+// Immutable array of tensors shared by every holder of the pointer, e.g. the
+// snapshots produced by a reconstruction run.
+typedef std::shared_ptr<const std::vector<Tensor>> SharedTensorArray;
+
 
 #endif //TEST_TENSORINDEXITERATOR_TENSOR_H
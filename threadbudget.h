@@ -0,0 +1,28 @@
+#ifndef THREADBUDGET_H
+#define THREADBUDGET_H
+
+#include <algorithm>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+inline int GetHardwareThreadCount()
+{
+    const unsigned num_threads = std::thread::hardware_concurrency();
+    return num_threads > 0 ? static_cast<int>(num_threads) : 1;
+}
+
+// Limits the number of threads used by OpenMP parallel regions started from
+// the calling thread, e.g. those inside SPECTProject::GenerateBackProject.
+inline void SetOmpThreadCount(int num_threads)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(std::max(1, num_threads));
+#else
+    (void) num_threads;
+#endif
+}
+
+#endif // THREADBUDGET_H
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Writes the FP16 and INT8 variants of the Scascnet restoration model.
+
+The variants are written next to the FP32 model with ".fp16" and ".int8"
+inserted before ".onnx", which is where ReconTaskParameter::GetModelPath()
+looks for them. INT8 activations are calibrated on windows cut from raw
+float32 sinograms shaped (num_slices, num_angles, num_detectors), normalized
+to unit mean as Scascnet does before every run.
+
+Check the result with `spect-recon-ui-new --check-restoration <task>` before
+using a variant for reconstructions.
+"""
+
+import argparse
+import os
+import sys
+
+import numpy as np
+import onnx
+from onnxruntime.quantization import (CalibrationDataReader, CalibrationMethod, QuantFormat,
+                                      QuantType, quantize_static)
+
+
+def variant_path(model_path, suffix):
+    base = model_path[:-len(".onnx")] if model_path.endswith(".onnx") else model_path
+    return base + suffix + ".onnx"
+
+
+class SinogramWindows(CalibrationDataReader):
+    """Feeds the model windows of the calibration sinograms one at a time."""
+
+    def __init__(self, input_name, window_shape, paths, num_angles, num_detectors, stride,
+                 max_windows):
+        depth, angles, detectors = window_shape
+        if (angles, detectors) != (num_angles, num_detectors):
+            sys.exit("Calibration sinograms must have the model geometry %dx%d." % (angles, detectors))
+        self.windows = []
+        for path in paths:
+            if len(self.windows) >= max_windows:
+                break
+            data = np.fromfile(path, dtype=np.float32)
+            volume = data.reshape(-1, num_angles, num_detectors)
+            for start in range(0, max(1, volume.shape[0] - depth + 1), stride):
+                window = np.zeros((depth, angles, detectors), dtype=np.float32)
+                part = volume[start:start + depth]
+                window[:part.shape[0]] = part
+                mean = window.mean()
+                if mean <= 0:
+                    continue
+                self.windows.append(window / mean)
+                if len(self.windows) >= max_windows:
+                    break
+        if not self.windows:
+            sys.exit("No calibration window could be taken from the given sinograms.")
+        self.input_name = input_name
+        self.next = 0
+
+    def get_next(self):
+        if self.next >= len(self.windows):
+            return None
+        window = self.windows[self.next]
+        self.next += 1
+        return {self.input_name: window[np.newaxis]}
+
+
+def write_fp16(model_path):
+    from onnxconverter_common import float16
+    model = float16.convert_float_to_float16(onnx.load(model_path), keep_io_types=True)
+    output_path = variant_path(model_path, ".fp16")
+    onnx.save(model, output_path)
+    return output_path
+
+
+def write_int8(model_path, sinograms, num_angles, num_detectors, stride, max_windows):
+    model = onnx.load(model_path)
+    model_input = model.graph.input[0]
+    dims = [d.dim_value for d in model_input.type.tensor_type.shape.dim]
+    reader = SinogramWindows(model_input.name, dims[1:], sinograms, num_angles, num_detectors,
+                             stride, max_windows)
+    output_path = variant_path(model_path, ".int8")
+    quantize_static(model_path, output_path, reader,
+                    quant_format=QuantFormat.QDQ,
+                    activation_type=QuantType.QUInt8,
+                    weight_type=QuantType.QInt8,
+                    per_channel=True,
+                    calibrate_method=CalibrationMethod.MinMax)
+    return output_path
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("model", help="the FP32 restoration model")
+    parser.add_argument("sinograms", nargs="*", help="raw float32 calibration sinograms")
+    parser.add_argument("--precision", choices=["fp16", "int8", "all"], default="all")
+    parser.add_argument("--num-angles", type=int, default=120)
+    parser.add_argument("--num-detectors", type=int, default=128)
+    parser.add_argument("--stride", type=int, default=8,
+                        help="slices between calibration windows")
+    parser.add_argument("--max-windows", type=int, default=256)
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.model):
+        sys.exit("Model not found: " + args.model)
+    if args.precision in ("fp16", "all"):
+        print("Wrote", write_fp16(args.model))
+    if args.precision in ("int8", "all"):
+        if not args.sinograms:
+            sys.exit("INT8 quantization needs calibration sinograms.")
+        print("Wrote", write_int8(args.model, args.sinograms, args.num_angles,
+                                  args.num_detectors, args.stride, args.max_windows))
+
+
+if __name__ == "__main__":
+    main()
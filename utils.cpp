@@ -29,17 +29,25 @@ std::vector<QPixmap> GetPixmapArrayFromTensor3D(const Tensor& tensor)
 }
 
 QPixmap GetPixmapFromTensor2D(const Tensor& tensor)
+{
+    return QPixmap::fromImage(GetImageFromTensor2D(tensor));
+}
+
+QImage GetImageFromTensor2D(const Tensor& tensor)
 {
     int height = tensor.shape()[0];
     int width = tensor.shape()[1];
+    const Tensor::DataType *data = tensor.data().data();
     QImage image(width, height, QImage::Format_RGB32);
     for (int j = 0; j < height; ++j) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(j));
+        const Tensor::DataType *row = data + static_cast<size_t>(j) * width;
         for (int k = 0; k < width; ++k) {
-            uint8_t value = static_cast<uint8_t>(tensor[{j, k}] * 255);
-            image.setPixel(k, j, qRgb(value, value, value));
+            uint8_t value = static_cast<uint8_t>(row[k] * 255);
+            line[k] = qRgb(value, value, value);
         }
     }
-    return QPixmap::fromImage(image);
+    return image;
 }
 
 QPixmap GetPixmapFromTensor3D(const Tensor& tensor, int index) {
@@ -5,7 +5,7 @@
 
 #include <QPixmap>
 #include <QLabel>
-#include <QPixmap>
+#include <QImage>
 
 #include "tensor.h"
 
@@ -13,5 +13,7 @@ void SetLabelImage(QLabel& label, const QPixmap& pixmap);
 std::vector<QPixmap> GetPixmapArrayFromTensor3D(const Tensor& tensor);
 QPixmap GetPixmapFromTensor3D(const Tensor& tensor, int index);
 QPixmap GetPixmapFromTensor2D(const Tensor& tensor);
+// Unlike QPixmap, QImage may be built outside of the GUI thread.
+QImage GetImageFromTensor2D(const Tensor& tensor);
 
 #endif // SPECT_RECON_UI_UTILS_H
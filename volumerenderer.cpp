@@ -0,0 +1,186 @@
+#include "volumerenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// acc[i] = max(acc[i], src[i]) for i in [0, n).
+void MaxAccumulate(float *acc, const float *src, int n)
+{
+    int i = 0;
+#if defined(__AVX__)
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(acc + i, _mm256_max_ps(_mm256_loadu_ps(acc + i), _mm256_loadu_ps(src + i)));
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(acc + i, _mm_max_ps(_mm_loadu_ps(acc + i), _mm_loadu_ps(src + i)));
+    }
+#endif
+    for (; i < n; ++i) {
+        acc[i] = std::max(acc[i], src[i]);
+    }
+}
+
+uchar ToGray(double value)
+{
+    if (value <= 0.) return 0;
+    if (value >= 1.) return 255;
+    return static_cast<uchar>(value * 255);
+}
+
+} // namespace
+
+int GetNumSlicesAlong(const Tensor& volume, SliceAxis axis)
+{
+    const auto& shape = volume.shape();
+    if (shape.size() != 3) return 0;
+    switch (axis) {
+    case SliceAxis::kAxial:
+        return shape[0];
+    case SliceAxis::kCoronal:
+        return shape[1];
+    case SliceAxis::kSagittal:
+        return shape[2];
+    }
+    return 0;
+}
+
+SliceView GetSliceView(const Tensor& volume, SliceAxis axis, int index)
+{
+    SliceView view;
+    const auto& shape = volume.shape();
+    if (shape.size() != 3 || index < 0 || index >= GetNumSlicesAlong(volume, axis)) {
+        return view;
+    }
+    const int num_slices = shape[0];
+    const int height = shape[1];
+    const int width = shape[2];
+    const std::ptrdiff_t slice_stride = static_cast<std::ptrdiff_t>(height) * width;
+    const Tensor::DataType *data = volume.data().data();
+    switch (axis) {
+    case SliceAxis::kAxial: {
+        view.origin = data + index * slice_stride;
+        view.rows = height;
+        view.cols = width;
+        view.row_stride = width;
+        view.col_stride = 1;
+        break;
+    }
+    case SliceAxis::kCoronal: {
+        view.origin = data + static_cast<std::ptrdiff_t>(index) * width;
+        view.rows = num_slices;
+        view.cols = width;
+        view.row_stride = slice_stride;
+        view.col_stride = 1;
+        break;
+    }
+    case SliceAxis::kSagittal: {
+        view.origin = data + index;
+        view.rows = num_slices;
+        view.cols = height;
+        view.row_stride = slice_stride;
+        view.col_stride = width;
+        break;
+    }
+    }
+    return view;
+}
+
+QImage GetImageFromSliceView(const SliceView& view, double min_value, double max_value)
+{
+    if (view.origin == nullptr) return QImage();
+    const double range = max_value - min_value;
+    const double scale = range > 1e-8 ? 1. / range : 0.;
+    QImage image(view.cols, view.rows, QImage::Format_Grayscale8);
+    for (int r = 0; r < view.rows; ++r) {
+        uchar *line = image.scanLine(r);
+        const Tensor::DataType *p = view.origin + r * view.row_stride;
+        for (int c = 0; c < view.cols; ++c, p += view.col_stride) {
+            line[c] = ToGray((*p - min_value) * scale);
+        }
+    }
+    return image;
+}
+
+MipRenderer::MipRenderer(const Tensor& volume)
+{
+    const auto& shape = volume.shape();
+    if (shape.size() != 3) return;
+    num_slices_ = shape[0];
+    height_ = shape[1];
+    width_ = shape[2];
+    image_width_ = static_cast<int>(std::ceil(std::sqrt(
+            static_cast<double>(height_) * height_ + static_cast<double>(width_) * width_)));
+
+    const double min_value = volume.GetMinimum();
+    const double max_value = volume.GetMaximum();
+    if (max_value - min_value > 1e-8) scale_ = static_cast<float>(1. / (max_value - min_value));
+
+    const Tensor::DataType *data = volume.data().data();
+    columns_.resize(static_cast<size_t>(num_slices_) * height_ * width_);
+    for (int z = 0; z < num_slices_; ++z) {
+        const Tensor::DataType *slice = data + static_cast<size_t>(z) * height_ * width_;
+        for (int i = 0; i < height_ * width_; ++i) {
+            columns_[static_cast<size_t>(i) * num_slices_ + z] = static_cast<float>(slice[i] - min_value);
+        }
+    }
+}
+
+QImage MipRenderer::Render(double angle) const
+{
+    if (IsEmpty()) return QImage();
+    QImage image(image_width_, num_slices_, QImage::Format_Grayscale8);
+    image.fill(0);
+    // Fetch the pointer before going parallel, as bits() may detach.
+    uchar *bits = image.bits();
+    const int bytes_per_line = image.bytesPerLine();
+
+    const int num_chunks = std::max(1, std::min(image_width_, QThreadPool::globalInstance()->maxThreadCount() * 4));
+    std::vector<std::pair<int, int> > chunks;
+    for (int i = 0; i < num_chunks; ++i) {
+        chunks.emplace_back(image_width_ * i / num_chunks, image_width_ * (i + 1) / num_chunks);
+    }
+    QtConcurrent::blockingMap(chunks, [&](const std::pair<int, int>& chunk) {
+        RenderColumns_(angle, chunk.first, chunk.second, bits, bytes_per_line);
+    });
+    return image;
+}
+
+void MipRenderer::RenderColumns_(double angle, int begin, int end, uchar *bits, int bytes_per_line) const
+{
+    const double theta = angle * kPi / 180.;
+    const double c = std::cos(theta);
+    const double s = std::sin(theta);
+    const double cx = width_ / 2.;
+    const double cy = height_ / 2.;
+    const double half = image_width_ / 2.;
+    std::vector<float> acc(num_slices_);
+    for (int u = begin; u < end; ++u) {
+        std::fill(acc.begin(), acc.end(), 0.f);
+        const double offset = u + 0.5 - half;
+        for (int step = 0; step < image_width_; ++step) {
+            const double t = step + 0.5 - half;
+            const int x = static_cast<int>(std::floor(cx + offset * c - t * s));
+            const int y = static_cast<int>(std::floor(cy + offset * s + t * c));
+            if (x < 0 || x >= width_ || y < 0 || y >= height_) continue;
+            MaxAccumulate(acc.data(), columns_.data() + (static_cast<size_t>(y) * width_ + x) * num_slices_,
+                          num_slices_);
+        }
+        for (int z = 0; z < num_slices_; ++z) {
+            bits[z * bytes_per_line + u] = ToGray(acc[z] * scale_);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef VOLUMERENDERER_H
+#define VOLUMERENDERER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <QImage>
+
+#include "tensor.h"
+
+// Volumes are laid out as (num_slices, height, width), i.e. (z, y, x).
+enum class SliceAxis {
+    kAxial, // fixed z, rows along y, columns along x
+    kCoronal, // fixed y, rows along z, columns along x
+    kSagittal, // fixed x, rows along z, columns along y
+};
+
+// Non-owning strided view of one plane of a volume. It is only valid as long
+// as the tensor it was taken from is neither destroyed nor written.
+struct SliceView
+{
+    const Tensor::DataType *origin = nullptr;
+    int rows = 0;
+    int cols = 0;
+    std::ptrdiff_t row_stride = 0;
+    std::ptrdiff_t col_stride = 0;
+
+    Tensor::DataType At(int row, int col) const {
+        return origin[row * row_stride + col * col_stride];
+    }
+};
+
+int GetNumSlicesAlong(const Tensor& volume, SliceAxis axis);
+SliceView GetSliceView(const Tensor& volume, SliceAxis axis, int index);
+// Values are mapped linearly from [min_value, max_value] to [0, 255].
+QImage GetImageFromSliceView(const SliceView& view, double min_value, double max_value);
+
+// Renders maximum-intensity projections of a volume rotating about its z axis.
+// The volume is converted once to float32 columns that are contiguous along z,
+// so every ray step is a vectorized max over a whole column.
+class MipRenderer
+{
+public:
+    explicit MipRenderer(const Tensor& volume);
+    // Projects along the direction rotated by `angle` degrees around z. The
+    // image columns are split over the global thread pool.
+    QImage Render(double angle) const;
+    bool IsEmpty() const { return columns_.empty(); }
+private:
+    void RenderColumns_(double angle, int begin, int end, uchar *bits, int bytes_per_line) const;
+
+    int num_slices_ = 0;
+    int height_ = 0;
+    int width_ = 0;
+    int image_width_ = 0;
+    float scale_ = 1.f;
+    std::vector<float> columns_; // (y, x, z)
+};
+
+#endif // VOLUMERENDERER_H
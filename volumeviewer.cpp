@@ -0,0 +1,152 @@
+#include "volumeviewer.h"
+
+#include <algorithm>
+
+#include <QGridLayout>
+#include <QPixmap>
+#include <QtConcurrent>
+
+#include "utils.h"
+
+namespace {
+
+QLabel *CreateImageLabel(const QString& text)
+{
+    QLabel *label = new QLabel(text);
+    label->setAlignment(Qt::AlignCenter);
+    label->setMinimumSize(256, 256);
+    label->setSizePolicy(QSizePolicy::Ignored, QSizePolicy::Ignored);
+    return label;
+}
+
+} // namespace
+
+VolumeViewer::VolumeViewer(const Tensor& volume, QWidget *parent) :
+    QDialog(parent),
+    volume_(volume),
+    mip_renderer_(volume)
+{
+    setWindowTitle(tr("Volume Viewer"));
+    if (!volume_.data().empty()) {
+        min_value_ = volume_.GetMinimum();
+        max_value_ = volume_.GetMaximum();
+    }
+
+    label_axial_ = CreateImageLabel(tr("Axial"));
+    label_coronal_ = CreateImageLabel(tr("Coronal"));
+    label_sagittal_ = CreateImageLabel(tr("Sagittal"));
+    label_mip_ = CreateImageLabel(tr("MIP"));
+    check_box_rotate_ = new QCheckBox(tr("Rotate"));
+    check_box_rotate_->setChecked(true);
+
+    slider_axial_ = CreateSlider_(SliceAxis::kAxial);
+    slider_coronal_ = CreateSlider_(SliceAxis::kCoronal);
+    slider_sagittal_ = CreateSlider_(SliceAxis::kSagittal);
+    connect(slider_axial_, SIGNAL(valueChanged(int)), this, SLOT(UpdateAxial_(int)));
+    connect(slider_coronal_, SIGNAL(valueChanged(int)), this, SLOT(UpdateCoronal_(int)));
+    connect(slider_sagittal_, SIGNAL(valueChanged(int)), this, SLOT(UpdateSagittal_(int)));
+
+    QGridLayout *layout = new QGridLayout(this);
+    layout->addWidget(new QLabel(tr("Axial")), 0, 0);
+    layout->addWidget(label_axial_, 1, 0);
+    layout->addWidget(slider_axial_, 2, 0);
+    layout->addWidget(new QLabel(tr("Coronal")), 0, 1);
+    layout->addWidget(label_coronal_, 1, 1);
+    layout->addWidget(slider_coronal_, 2, 1);
+    layout->addWidget(new QLabel(tr("Sagittal")), 3, 0);
+    layout->addWidget(label_sagittal_, 4, 0);
+    layout->addWidget(slider_sagittal_, 5, 0);
+    layout->addWidget(new QLabel(tr("Maximum Intensity Projection")), 3, 1);
+    layout->addWidget(label_mip_, 4, 1);
+    layout->addWidget(check_box_rotate_, 5, 1);
+    layout->setRowStretch(1, 1);
+    layout->setRowStretch(4, 1);
+
+    UpdateAxial_(slider_axial_->value());
+    UpdateCoronal_(slider_coronal_->value());
+    UpdateSagittal_(slider_sagittal_->value());
+
+    watcher_mip_ = new QFutureWatcher<QImage>(this);
+    connect(watcher_mip_, SIGNAL(finished()), this, SLOT(MipFrameReady_()));
+    timer_mip_ = new QTimer(this);
+    timer_mip_->setInterval(50);
+    connect(timer_mip_, SIGNAL(timeout()), this, SLOT(NextMipFrame_()));
+    if (!mip_renderer_.IsEmpty()) {
+        NextMipFrame_();
+        timer_mip_->start();
+    }
+    resize(900, 900);
+}
+
+VolumeViewer::~VolumeViewer()
+{
+    timer_mip_->stop();
+    watcher_mip_->waitForFinished();
+}
+
+QSlider *VolumeViewer::CreateSlider_(SliceAxis axis)
+{
+    QSlider *slider = new QSlider(Qt::Horizontal);
+    const int num_slices = GetNumSlicesAlong(volume_, axis);
+    slider->setMinimum(0);
+    slider->setMaximum(std::max(0, num_slices - 1));
+    slider->setValue(num_slices / 2);
+    slider->setEnabled(num_slices > 1);
+    return slider;
+}
+
+void VolumeViewer::UpdateSlice_(SliceAxis axis, QLabel *label, int index)
+{
+    // The view reads the volume in place; only the 8-bit image is allocated.
+    QImage image = GetImageFromSliceView(GetSliceView(volume_, axis, index), min_value_, max_value_);
+    if (image.isNull()) return;
+    SetLabelImage(*label, QPixmap::fromImage(image));
+}
+
+void VolumeViewer::UpdateAxial_(int index)
+{
+    UpdateSlice_(SliceAxis::kAxial, label_axial_, index);
+}
+
+void VolumeViewer::UpdateCoronal_(int index)
+{
+    UpdateSlice_(SliceAxis::kCoronal, label_coronal_, index);
+}
+
+void VolumeViewer::UpdateSagittal_(int index)
+{
+    UpdateSlice_(SliceAxis::kSagittal, label_sagittal_, index);
+}
+
+void VolumeViewer::NextMipFrame_()
+{
+    // Drop the frame if the previous one is still being rendered.
+    if (watcher_mip_->isRunning()) return;
+    if (check_box_rotate_->isChecked()) {
+        mip_angle_ += 6.;
+        if (mip_angle_ >= 360.) mip_angle_ -= 360.;
+    } else if (label_mip_->pixmap()) {
+        return;
+    }
+    const MipRenderer *renderer = &mip_renderer_;
+    const double angle = mip_angle_;
+    watcher_mip_->setFuture(QtConcurrent::run([renderer, angle]() {
+        return renderer->Render(angle);
+    }));
+}
+
+void VolumeViewer::MipFrameReady_()
+{
+    QImage image = watcher_mip_->result();
+    if (image.isNull()) return;
+    SetLabelImage(*label_mip_, QPixmap::fromImage(image));
+}
+
+void VolumeViewer::resizeEvent(QResizeEvent *event)
+{
+    QDialog::resizeEvent(event);
+    UpdateAxial_(slider_axial_->value());
+    UpdateCoronal_(slider_coronal_->value());
+    UpdateSagittal_(slider_sagittal_->value());
+    if (label_mip_->pixmap()) SetLabelImage(*label_mip_, *label_mip_->pixmap());
+}
@@ -0,0 +1,57 @@
+#ifndef VOLUMEVIEWER_H
+#define VOLUMEVIEWER_H
+
+#include <QDialog>
+#include <QLabel>
+#include <QSlider>
+#include <QCheckBox>
+#include <QTimer>
+#include <QFutureWatcher>
+#include <QImage>
+#include <QResizeEvent>
+
+#include "tensor.h"
+#include "volumerenderer.h"
+
+// Shows axial, coronal and sagittal reslices of a reconstructed volume together
+// with a rotating maximum-intensity projection.
+class VolumeViewer : public QDialog
+{
+    Q_OBJECT
+public:
+    explicit VolumeViewer(const Tensor& volume, QWidget *parent = nullptr);
+    ~VolumeViewer();
+protected:
+    virtual void resizeEvent(QResizeEvent *event) override;
+
+private slots:
+    void UpdateAxial_(int index);
+    void UpdateCoronal_(int index);
+    void UpdateSagittal_(int index);
+    void NextMipFrame_();
+    void MipFrameReady_();
+
+private:
+    QSlider *CreateSlider_(SliceAxis axis);
+    void UpdateSlice_(SliceAxis axis, QLabel *label, int index);
+
+    // The viewer holds its own reference so the reslice views stay valid.
+    Tensor volume_;
+    double min_value_ = 0.;
+    double max_value_ = 1.;
+    MipRenderer mip_renderer_;
+    double mip_angle_ = 0.;
+
+    QLabel *label_axial_;
+    QLabel *label_coronal_;
+    QLabel *label_sagittal_;
+    QLabel *label_mip_;
+    QSlider *slider_axial_;
+    QSlider *slider_coronal_;
+    QSlider *slider_sagittal_;
+    QCheckBox *check_box_rotate_;
+    QTimer *timer_mip_;
+    QFutureWatcher<QImage> *watcher_mip_;
+};
+
+#endif // VOLUMEVIEWER_H